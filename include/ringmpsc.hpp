@@ -15,9 +15,17 @@
 #include <array>
 #include <atomic>
 #include <bit>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <ctime>
 #include <expected>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <numeric>
 #include <optional>
 #include <ranges>
 #include <span>
@@ -25,13 +33,47 @@
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace ringmpsc {
 
+// Backing memory for ring storage.
+enum class MemoryPolicy : std::uint8_t {
+    Heap,      // operator new, cache-line aligned
+    HugePages, // mmap(MAP_HUGETLB), else madvise(MADV_HUGEPAGE), else normal pages
+    Mirrored,  // memfd mapped twice back to back; spans never split at the wrap (DynamicRing, Linux)
+};
+
+// Order in which Channel::recv/consume_all visit the rings.
+enum class Schedule : std::uint8_t {
+    InOrder,  // From ring 0, draining each ring fully
+    Rotate,   // Start one ring later on every call
+    Quota,    // Rotate, taking at most schedule_quota items per ring per call
+    Weighted, // Quota scaled by each producer's weight (Channel::set_weight)
+};
+
 struct Config {
-    std::size_t ring_bits = 16;     // Ring size as power-of-two (default: 64K slots)
-    std::size_t max_producers = 16; // Maximum number of producers
-    bool enable_metrics = false;    // Collect counters
+    std::size_t ring_bits = 16;                  // Ring size as power-of-two (default: 64K slots)
+    std::size_t max_producers = 16;              // Maximum number of producers
+    bool enable_metrics = false;                 // Collect counters
+    MemoryPolicy memory = MemoryPolicy::Heap;    // Backing for ring storage
+    std::size_t tail_publish_every = 1;          // Commits per tail publication (1 = every commit)
+    std::size_t tail_publish_fill = 50;          // ...or publish once the ring is this % full
+    std::size_t head_publish_every = 0;          // Items consumed per head publication (0 = once per batch)
+    std::size_t head_publish_percent = 0;        // ...or every this % of capacity, if head_publish_every is 0
+    bool drop_newest = false;                    // A full ring drops the new items (counted) instead of waiting
+    std::size_t max_consumers = 8;               // Read cursors per BroadcastRing
+    Schedule schedule = Schedule::InOrder;       // Ring visiting order in Channel::recv/consume_all
+    std::size_t schedule_quota = 256;            // Items per ring per call under Quota/Weighted
+    bool sequence_stamps = false;                // Stamp items with a channel-wide sequence (total order)
 
     friend constexpr bool operator==(const Config&, const Config&) = default;
 };
@@ -39,6 +81,7 @@ struct Config {
 inline constexpr Config default_config{};
 inline constexpr Config low_latency_config{.ring_bits = 12};
 inline constexpr Config high_throughput_config{.ring_bits = 18, .max_producers = 32};
+inline constexpr Config huge_page_config{.ring_bits = 18, .max_producers = 32, .memory = MemoryPolicy::HugePages};
 
 // ---------------------------------------------------------------------------
 // Utility
@@ -75,6 +118,421 @@ constexpr To narrow_cast(From v) noexcept {
     return static_cast<To>(v);
 }
 
+// Ring storage allocation. Heap uses aligned operator new, page-aligned once
+// the request reaches a page so NUMA binding never drags in a neighbour.
+// HugePages maps whole 2 MiB pages: explicit hugetlb pages first, then an
+// aligned anonymous mapping advised for transparent huge pages, which the
+// kernel silently backs with normal pages if neither is available. Both throw
+// std::bad_alloc on failure, and release_storage() must get the same bytes
+// and policy.
+
+inline constexpr std::size_t page_size = 4096;
+inline constexpr std::size_t huge_page_size = std::size_t{2} << 20;
+
+constexpr std::size_t round_up(std::size_t v, std::size_t align) {
+    return (v + align - 1) & ~(align - 1);
+}
+
+constexpr std::align_val_t heap_alignment(std::size_t bytes) {
+    return std::align_val_t{bytes >= page_size ? page_size : 128};
+}
+
+inline void* allocate_storage(std::size_t bytes, MemoryPolicy policy) {
+#if defined(__linux__)
+    if (policy == MemoryPolicy::HugePages) {
+        const auto len = round_up(bytes, huge_page_size);
+        void* p = ::mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED) {
+            return p;
+        }
+
+        // Over-map so the region can be trimmed to a huge-page boundary.
+        const auto span = len + huge_page_size;
+        auto* raw = static_cast<std::byte*>(
+            ::mmap(nullptr, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        if (raw == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        const auto addr = reinterpret_cast<std::uintptr_t>(raw);
+        auto* aligned = raw + (round_up(addr, huge_page_size) - addr);
+        if (aligned != raw) {
+            ::munmap(raw, detail::narrow_cast<std::size_t>(aligned - raw));
+        }
+        if (const auto tail = detail::narrow_cast<std::size_t>((raw + span) - (aligned + len)); tail != 0) {
+            ::munmap(aligned + len, tail);
+        }
+#if defined(MADV_HUGEPAGE)
+        ::madvise(aligned, len, MADV_HUGEPAGE);
+#endif
+        return aligned;
+    }
+#endif
+    (void)policy;
+    return ::operator new(bytes, heap_alignment(bytes));
+}
+
+inline void release_storage(void* p, std::size_t bytes, MemoryPolicy policy) noexcept {
+    if (p == nullptr) {
+        return;
+    }
+#if defined(__linux__)
+    if (policy == MemoryPolicy::HugePages) {
+        ::munmap(p, round_up(bytes, huge_page_size));
+        return;
+    }
+#endif
+    (void)policy;
+    ::operator delete(p, heap_alignment(bytes));
+}
+
+// Objects (rings) get whole pages to themselves.
+template <typename T, MemoryPolicy policy, typename... Args>
+T* create(Args&&... args) {
+    static_assert(alignof(T) <= 128, "allocate_storage aligns to 128 bytes");
+    constexpr auto bytes = round_up(sizeof(T), page_size);
+    void* mem = allocate_storage(bytes, policy);
+    try {
+        return std::construct_at(static_cast<T*>(mem), std::forward<Args>(args)...);
+    } catch (...) {
+        release_storage(mem, bytes, policy);
+        throw;
+    }
+}
+
+template <typename T, MemoryPolicy policy>
+void destroy(T* p) noexcept {
+    if (p != nullptr) {
+        std::destroy_at(p);
+        release_storage(p, round_up(sizeof(T), page_size), policy);
+    }
+}
+
+// Slot storage for BasicRing. All expose capacity(), mask() and data();
+// storage allocated outside the ring object also exposes bytes(). Mirrored
+// storage additionally guarantees data()[i] aliases
+// data()[i + capacity()], so a run never has to split at the wrap.
+
+// Slots of trivial T are plain objects copied with memcpy. Any other T lives
+// in raw storage: constructed when produced, destroyed when consumed.
+template <typename T>
+inline constexpr bool trivial_slot_v = std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T>;
+
+// Handlers may take a whole contiguous run, process(std::span<const T>),
+// instead of one item at a time, process(const T*).
+template <typename Handler, typename Span>
+concept span_handler = requires(Handler& h, Span run) { h.process(run); };
+
+// With Config::sequence_stamps, a handler may instead take each item with
+// its global sequence, process(const T*, std::uint64_t).
+template <typename Handler, typename Pointer>
+concept sequenced_handler = requires(Handler& h, Pointer item, std::uint64_t seq) { h.process(item, seq); };
+
+template <typename Handler, typename Pointer, typename Span>
+constexpr bool nothrow_handler() {
+    if constexpr (span_handler<Handler, Span>) {
+        return noexcept(std::declval<Handler&>().process(std::declval<Span>()));
+    } else if constexpr (sequenced_handler<Handler, Pointer>) {
+        return noexcept(std::declval<Handler&>().process(std::declval<Pointer>(), std::uint64_t{}));
+    } else {
+        return noexcept(std::declval<Handler&>().process(std::declval<Pointer>()));
+    }
+}
+
+template <typename T>
+struct RawSlot {
+    alignas(T) std::byte bytes[sizeof(T)];
+};
+
+template <typename T, std::size_t N>
+struct InlineStorage {
+    static constexpr bool mirrored = false;
+
+    static constexpr std::size_t capacity() noexcept { return N; }
+    static constexpr std::size_t mask() noexcept { return N - 1; }
+
+    T* data() noexcept {
+        if constexpr (trivial_slot_v<T>) {
+            return items.data();
+        } else {
+            return std::launder(reinterpret_cast<T*>(items.data()));
+        }
+    }
+    const T* data() const noexcept { return const_cast<InlineStorage*>(this)->data(); }
+
+    alignas(64) std::conditional_t<trivial_slot_v<T>, std::array<T, N>, std::array<RawSlot<T>, N>> items;
+};
+
+// Runtime capacity rounded up to a power of two. Throws std::bad_alloc if
+// that, or its size in bytes times copies, does not fit a size_t.
+template <typename T>
+std::size_t checked_capacity(std::size_t capacity, std::size_t copies = 1) {
+    if (capacity > SIZE_MAX / 2 + 1) {
+        throw std::bad_alloc();
+    }
+    const auto slots = std::bit_ceil(std::max<std::size_t>(capacity, 1));
+    if (slots > SIZE_MAX / sizeof(T) / copies) {
+        throw std::bad_alloc();
+    }
+    return slots;
+}
+
+template <typename T, MemoryPolicy policy>
+class HeapStorage {
+public:
+    static constexpr bool mirrored = false;
+
+    explicit HeapStorage(std::size_t capacity)
+        : capacity_(checked_capacity<T>(capacity)),
+          data_(static_cast<T*>(allocate_storage(capacity_ * sizeof(T), policy))) {}
+
+    ~HeapStorage() { release_storage(data_, capacity_ * sizeof(T), policy); }
+
+    std::size_t bytes() const noexcept { return capacity_ * sizeof(T); }
+
+    HeapStorage(const HeapStorage&) = delete;
+    HeapStorage& operator=(const HeapStorage&) = delete;
+
+    std::size_t capacity() const noexcept { return capacity_; }
+    std::size_t mask() const noexcept { return capacity_ - 1; }
+
+    T* data() noexcept { return data_; }
+    const T* data() const noexcept { return data_; }
+
+private:
+    std::size_t capacity_;
+    T* data_;
+};
+
+#if defined(__linux__)
+// One memfd mapped twice into adjacent address ranges. The capacity is
+// raised until the buffer is a whole number of pages.
+template <typename T>
+class MirroredStorage {
+    static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                  "mirrored storage aliases slots and needs trivially copyable T");
+
+public:
+    static constexpr bool mirrored = true;
+
+    explicit MirroredStorage(std::size_t capacity) {
+        const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const auto min_slots = page / std::gcd(sizeof(T), page);
+        capacity_ = checked_capacity<T>(std::max(capacity, min_slots), 2);
+        bytes_ = capacity_ * sizeof(T);
+
+        const int fd = ::memfd_create("ringmpsc", MFD_CLOEXEC);
+        if (fd < 0) {
+            throw std::bad_alloc();
+        }
+        if (::ftruncate(fd, static_cast<off_t>(bytes_)) != 0) {
+            ::close(fd);
+            throw std::bad_alloc();
+        }
+
+        // Reserve both halves first so the second mapping cannot collide.
+        auto* base = static_cast<std::byte*>(
+            ::mmap(nullptr, 2 * bytes_, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        const bool ok = base != MAP_FAILED &&
+                        ::mmap(base, bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED &&
+                        ::mmap(base + bytes_, bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) !=
+                            MAP_FAILED;
+        ::close(fd);
+        if (!ok) {
+            if (base != MAP_FAILED) {
+                ::munmap(base, 2 * bytes_);
+            }
+            throw std::bad_alloc();
+        }
+        data_ = reinterpret_cast<T*>(base);
+    }
+
+    ~MirroredStorage() { ::munmap(data_, 2 * bytes_); }
+
+    MirroredStorage(const MirroredStorage&) = delete;
+    MirroredStorage& operator=(const MirroredStorage&) = delete;
+
+    std::size_t capacity() const noexcept { return capacity_; }
+    std::size_t mask() const noexcept { return capacity_ - 1; }
+    std::size_t bytes() const noexcept { return bytes_; }
+
+    T* data() noexcept { return data_; }
+    const T* data() const noexcept { return data_; }
+
+private:
+    std::size_t capacity_ = 0;
+    std::size_t bytes_ = 0;
+    T* data_ = nullptr;
+};
+#endif
+
+template <typename T, MemoryPolicy policy>
+struct heap_storage {
+    using type = HeapStorage<T, policy>;
+};
+
+#if defined(__linux__)
+template <typename T>
+struct heap_storage<T, MemoryPolicy::Mirrored> {
+    using type = MirroredStorage<T>;
+};
+#endif
+
+template <typename T, MemoryPolicy policy>
+using heap_storage_t = typename heap_storage<T, policy>::type;
+
+// Fixed-length array of non-movable elements, constructed in place in one
+// allocation aligned for T.
+template <typename T>
+class HeapArray {
+public:
+    template <typename... Args>
+    explicit HeapArray(std::size_t count, const Args&... args)
+        : size_(count),
+          data_(static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{alignof(T)}))) {
+        std::size_t i = 0;
+        try {
+            for (; i < size_; ++i) {
+                std::construct_at(data_ + i, args...);
+            }
+        } catch (...) {
+            std::destroy_n(data_, i);
+            ::operator delete(data_, std::align_val_t{alignof(T)});
+            throw;
+        }
+    }
+
+    ~HeapArray() {
+        std::destroy_n(data_, size_);
+        ::operator delete(data_, std::align_val_t{alignof(T)});
+    }
+
+    HeapArray(const HeapArray&) = delete;
+    HeapArray& operator=(const HeapArray&) = delete;
+
+    std::size_t size() const noexcept { return size_; }
+    T* data() noexcept { return data_; }
+
+    T& operator[](std::size_t i) noexcept { return data_[i]; }
+    const T& operator[](std::size_t i) const noexcept { return data_[i]; }
+
+private:
+    std::size_t size_;
+    T* data_;
+};
+
+// Words in level `level` of a readiness hierarchy over `bits` slots: level
+// 0 has a bit per slot, each level above a bit per word of the one below.
+constexpr std::size_t bitmap_words(std::size_t bits, std::size_t level) {
+    const auto words = (bits + 63) / 64;
+    return level == 0 ? words : bitmap_words(words, level - 1);
+}
+
+// Ready bitmap (at a level) for a channel slot table: fixed size next to
+// std::array slots, sized at construction next to a HeapArray.
+template <typename Slots, std::size_t Level = 0>
+struct ready_bitmap {
+    using type = HeapArray<std::atomic<std::uint64_t>>;
+};
+
+template <typename U, std::size_t N, std::size_t Level>
+struct ready_bitmap<std::array<U, N>, Level> {
+    using type = std::array<std::atomic<std::uint64_t>, bitmap_words(N, Level)>;
+};
+
+template <typename Slots, std::size_t Level = 0>
+using ready_bitmap_t = typename ready_bitmap<Slots, Level>::type;
+
+// One U per slot, stored like Slots.
+template <typename Slots, typename U>
+struct slot_array {
+    using type = HeapArray<U>;
+};
+
+template <typename V, std::size_t N, typename U>
+struct slot_array<std::array<V, N>, U> {
+    using type = std::array<U, N>;
+};
+
+template <typename Slots, typename U>
+using slot_array_t = typename slot_array<Slots, U>::type;
+
+// Config::sequence_stamps state of a ring: the counter tickets are drawn
+// from (the ring's own until a Channel points it at a shared one) and the
+// stamp of each slot. Empty when the flag is off.
+template <bool enabled>
+struct SequenceStamps {
+    explicit SequenceStamps(std::size_t) noexcept {}
+};
+
+template <>
+struct SequenceStamps<true> {
+    explicit SequenceStamps(std::size_t slots) : stamps(slots) {}
+
+    std::atomic<std::uint64_t>* source = &own;
+    std::atomic<std::uint64_t> own{0};
+    HeapArray<std::uint64_t> stamps;
+};
+
+// A channel-wide ticket counter on its own line.
+struct SequenceCounter {
+    alignas(128) std::atomic<std::uint64_t> next{0};
+};
+
+// Thread-local producers (Channel::send_local() and friends). Channels get
+// ids that are never reused, so a cache entry left by a destroyed channel
+// cannot match a new one at the same address. local_cache is the fast
+// path: the last channel the thread sent on. local_producers owns every
+// registration of the thread and retires them at thread exit, but only
+// for channels still alive: channels that handed out local producers
+// leave LocalRegistry under its mutex before destroying their rings.
+inline std::atomic<std::uint64_t> next_channel_id{1};
+
+struct LocalRegistry {
+    static LocalRegistry& instance() {
+        static LocalRegistry registry;
+        return registry;
+    }
+
+    std::mutex mutex;
+    std::vector<std::uint64_t> live;
+};
+
+struct LocalCache {
+    std::uint64_t channel = 0;
+    void* ring = nullptr;
+    std::size_t id = 0;
+};
+
+inline thread_local LocalCache local_cache;
+
+struct LocalProducer {
+    std::uint64_t channel;
+    void* ring;
+    std::size_t id;
+    void (*retire)(void*) noexcept;
+};
+
+struct LocalProducers {
+    LocalProducers() = default;
+    LocalProducers(const LocalProducers&) = delete;
+    LocalProducers& operator=(const LocalProducers&) = delete;
+
+    ~LocalProducers() {
+        local_cache = {};
+        auto& registry = LocalRegistry::instance();
+        const std::lock_guard lock(registry.mutex);
+        for (const auto& p : entries) {
+            if (std::ranges::find(registry.live, p.channel) != registry.live.end()) {
+                p.retire(p.ring);
+            }
+        }
+    }
+
+    std::vector<LocalProducer> entries;
+};
+
+inline thread_local LocalProducers local_producers;
+
 } // namespace detail
 
 // ---------------------------------------------------------------------------
@@ -120,343 +578,2758 @@ private:
 };
 
 // ---------------------------------------------------------------------------
-// Metrics
-// ---------------------------------------------------------------------------
-
-struct Metrics {
-    std::uint64_t messages_sent = 0;
-    std::uint64_t messages_received = 0;
-    std::uint64_t batches_sent = 0;
-    std::uint64_t batches_received = 0;
-    std::uint64_t reserve_spins = 0;
-};
-
-// ---------------------------------------------------------------------------
-// Reservation handle (zero-copy)
+// Blocking waits (eventcount)
 // ---------------------------------------------------------------------------
 
-template <typename T>
-struct Reservation {
-    std::span<T> slice;
-    std::uint64_t pos = 0;
-};
-
-// ---------------------------------------------------------------------------
-// SPSC Ring Buffer
-// ---------------------------------------------------------------------------
+inline constexpr std::chrono::nanoseconds wait_forever = std::chrono::nanoseconds::max();
 
-template <typename T, Config config = default_config>
-class Ring {
-    static_assert(config.ring_bits < (sizeof(std::size_t) * 8), "ring_bits too large");
-    static_assert(detail::is_power_of_two(std::size_t{1} << config.ring_bits), "ring size must be power of two");
+namespace detail {
 
-public:
-    static constexpr std::size_t capacity() noexcept { return CAPACITY; }
-    static constexpr std::size_t mask() noexcept { return MASK; }
+#if defined(__linux__) && defined(SYS_membarrier) && !defined(RINGMPSC_NO_MEMBARRIER)
+inline constexpr int membarrier_global = 1 << 0;
+inline constexpr int membarrier_private_expedited = 1 << 3;
+inline constexpr int membarrier_register_private_expedited = 1 << 4;
+
+// Queried on the first barrier rather than from a static initializer, so
+// programs that never publish make no syscall.
+[[nodiscard]] inline bool has_membarrier() noexcept {
+    static const bool supported = [] {
+        const long cmds = ::syscall(SYS_membarrier, 0, 0, 0);
+        return cmds > 0 && (cmds & membarrier_private_expedited) != 0;
+    }();
+    return supported;
+}
 
-    Ring() = default;
+// Only the issuing side needs the process registered, so the first
+// heavy_barrier() registers. It cannot fail once the query reported the
+// command; the global one stands in if it does.
+inline void membarrier() noexcept {
+    static const bool registered = ::syscall(SYS_membarrier, membarrier_register_private_expedited, 0, 0) == 0;
+    ::syscall(SYS_membarrier, registered ? membarrier_private_expedited : membarrier_global, 0, 0);
+}
+#else
+[[nodiscard]] constexpr bool has_membarrier() noexcept { return false; }
+inline void membarrier() noexcept {}
+#endif
 
-    [[nodiscard]] std::size_t len() const noexcept {
-        const auto t = tail_.load(std::memory_order_relaxed);
-        const auto h = head_.load(std::memory_order_relaxed);
-        return detail::narrow_cast<std::size_t>(t - h);
+// Asymmetric fence pair ordering a position store against a waiter-count
+// load. Publishers run light_barrier() on every publication; with membarrier
+// it is only a compiler barrier, and the waiter about to sleep pays for both
+// sides in heavy_barrier(). Without membarrier (non-Linux, kernels before
+// 4.14, a seccomp filter, or RINGMPSC_NO_MEMBARRIER) both are full fences,
+// and every publication pays a locked instruction: about 7 ns per
+// single-item commit on x86, where the commit itself is about 2 ns.
+// config.tail_publish_every amortizes it over several commits.
+inline void light_barrier() noexcept {
+    if (has_membarrier()) {
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    } else {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
     }
+}
 
-    [[nodiscard]] bool is_empty() const noexcept {
-        return tail_.load(std::memory_order_relaxed) == head_.load(std::memory_order_relaxed);
+inline void heavy_barrier() noexcept {
+    if (has_membarrier()) {
+        membarrier();
+        return;
     }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
 
-    [[nodiscard]] bool is_full() const noexcept { return len() >= CAPACITY; }
-
-    [[nodiscard]] bool is_closed() const noexcept { return closed_.load(std::memory_order_acquire); }
+class Deadline {
+public:
+    explicit Deadline(std::chrono::nanoseconds timeout) noexcept
+        : infinite_(timeout == wait_forever), at_(infinite_ ? Clock::time_point{} : Clock::now() + timeout) {}
 
-    // Reserve n slots for zero-copy writing. Returns empty optional if full/closed.
-    [[nodiscard]] std::optional<Reservation<T>> reserve(std::size_t n) noexcept {
-        if (n == 0 || n > CAPACITY) {
-            return std::nullopt;
-        }
+    [[nodiscard]] bool infinite() const noexcept { return infinite_; }
+    [[nodiscard]] bool expired() const noexcept { return !infinite_ && Clock::now() >= at_; }
+    [[nodiscard]] std::chrono::nanoseconds remaining() const noexcept {
+        return infinite_ ? wait_forever : std::max<std::chrono::nanoseconds>(at_ - Clock::now(), {});
+    }
 
-        const auto tail = tail_.load(std::memory_order_relaxed);
+private:
+    using Clock = std::chrono::steady_clock;
 
-        // Fast path: cached head
-        auto space = CAPACITY - detail::narrow_cast<std::size_t>(tail - cached_head_);
-        if (space >= n) {
-            return make_reservation(tail, n);
-        }
+    bool infinite_;
+    Clock::time_point at_;
+};
 
-        cached_head_ = head_.load(std::memory_order_acquire);
-        space = CAPACITY - detail::narrow_cast<std::size_t>(tail - cached_head_);
-        if (space < n || is_closed()) {
-            return std::nullopt;
-        }
+// Waiters announce themselves with prepare_wait(), re-check their condition,
+// then wait(). notify() costs a barrier and a load unless someone announced;
+// only then does it bump the epoch and issue a futex wake.
+//
+// An eventfd can be attached as an extra, edge-style waiter: arm_fd()
+// announces it, and the first notify() that sees it armed disarms it and
+// writes the fd once. A parent EventCount (a Poller's) is forwarded to the
+// same way after arm_parent().
+class EventCount {
+public:
+    using Key = std::uint32_t;
 
-        return make_reservation(tail, n);
+    [[nodiscard]] Key prepare_wait() noexcept {
+        state_.fetch_add(1, std::memory_order_relaxed);
+        heavy_barrier();
+        return epoch_.load(std::memory_order_acquire);
     }
 
-    // Reserve with adaptive backoff. Spins then yields before giving up.
-    [[nodiscard]] std::optional<Reservation<T>> reserve_with_backoff(std::size_t n) noexcept {
-        Backoff backoff;
-        while (!backoff.is_completed()) {
-            if (auto r = reserve(n)) {
-                return r;
-            }
-            if (is_closed()) {
-                return std::nullopt;
+    void cancel_wait() noexcept { state_.fetch_sub(1, std::memory_order_relaxed); }
+
+    // Ends the wait begun by prepare_wait(). Returns false on timeout.
+    bool wait(Key key, const Deadline& deadline) noexcept {
+        bool notified = true;
+        while (epoch_.load(std::memory_order_acquire) == key) {
+            if (deadline.expired()) {
+                notified = false;
+                break;
             }
-            backoff.snooze();
+            sleep(key, deadline);
         }
-        return std::nullopt;
+        cancel_wait();
+        return notified;
     }
 
-    void commit(std::size_t n) noexcept {
-        tail_.fetch_add(detail::narrow_cast<std::uint64_t>(n), std::memory_order_release);
+    void notify() noexcept {
+        light_barrier();
+        notify_after_barrier();
+    }
 
-        if constexpr (config.enable_metrics) {
-            metrics_.messages_sent += n;
-            metrics_.batches_sent += 1;
+    // notify() for callers that already ran light_barrier().
+    void notify_after_barrier() noexcept {
+        const auto state = state_.load(std::memory_order_relaxed);
+        if (state == 0) {
+            return;
+        }
+        if ((state & fd_armed) != 0 && disarm_fd()) {
+            signal_fd();
+        }
+        if ((state & parent_armed) != 0 &&
+            (state_.fetch_and(~parent_armed, std::memory_order_acq_rel) & parent_armed) != 0) {
+            parent_->notify();
+        }
+        if ((state & waiter_mask) != 0) {
+            epoch_.fetch_add(1, std::memory_order_release);
+            wake();
         }
     }
 
-    // Consumer API
-    [[nodiscard]] std::optional<std::span<const T>> readable() noexcept {
-        const auto head = head_.load(std::memory_order_relaxed);
-
-        auto avail = cached_tail_ - head;
-        if (avail == 0) {
-            cached_tail_ = tail_.load(std::memory_order_acquire);
-            avail = cached_tail_ - head;
-            if (avail == 0) {
-                return std::nullopt;
-            }
-        }
+    // Set before the first arm_fd(), which publishes it to notifiers;
+    // signal_fd() is only called after a successful disarm_fd().
+    void attach_fd(int fd) noexcept { fd_ = fd; }
 
-        const auto idx = head & MASK;
-        const auto contiguous = std::min<std::uint64_t>(avail, CAPACITY - idx);
+    // Set before the first arm_parent(), which publishes it to notifiers.
+    void attach_parent(EventCount* parent) noexcept { parent_ = parent; }
 
-        const auto next_idx = (head + contiguous) & MASK;
-        detail::prefetch(buffer_.data() + next_idx, false);
+    // Announces the parent. Unlike arm_fd() there is no barrier here: the
+    // caller arms several events and then runs one, through the parent's
+    // prepare_wait().
+    void arm_parent() noexcept { state_.fetch_or(parent_armed, std::memory_order_release); }
+    void disarm_parent() noexcept { state_.fetch_and(~parent_armed, std::memory_order_relaxed); }
 
-        return std::span<const T>{buffer_.data() + idx, buffer_.data() + idx + contiguous};
+    // Announces the fd; follow with a re-check of the condition, as for
+    // prepare_wait().
+    void arm_fd() noexcept {
+        state_.fetch_or(fd_armed, std::memory_order_release);
+        heavy_barrier();
     }
 
-    void advance(std::size_t n) noexcept {
-        head_.store(head_.load(std::memory_order_relaxed) + detail::narrow_cast<std::uint64_t>(n),
-                    std::memory_order_release);
+    // True if this call took the fd out of the armed state.
+    bool disarm_fd() noexcept {
+        return (state_.fetch_and(~fd_armed, std::memory_order_acq_rel) & fd_armed) != 0;
+    }
 
-        if constexpr (config.enable_metrics) {
-            metrics_.messages_received += n;
-            metrics_.batches_received += 1;
-        }
+    void signal_fd() const noexcept {
+#if defined(__linux__)
+        const std::uint64_t one = 1;
+        [[maybe_unused]] const auto written = ::write(fd_, &one, sizeof(one));
+#endif
     }
 
-    template <typename Handler>
-    std::size_t consume_batch(Handler&& handler) noexcept(noexcept(handler.process(static_cast<const T*>(nullptr)))) {
-        auto head = head_.load(std::memory_order_relaxed);
-        const auto tail = tail_.load(std::memory_order_acquire);
+    void clear_fd() const noexcept {
+#if defined(__linux__)
+        std::uint64_t count = 0;
+        [[maybe_unused]] const auto read = ::read(fd_, &count, sizeof(count));
+#endif
+    }
 
-        auto avail = tail - head;
-        if (avail == 0) {
-            return 0;
+private:
+    static constexpr std::uint32_t fd_armed = std::uint32_t{1} << 31;
+    static constexpr std::uint32_t parent_armed = std::uint32_t{1} << 30;
+    static constexpr std::uint32_t waiter_mask = ~(fd_armed | parent_armed);
+
+    void sleep(Key key, const Deadline& deadline) noexcept {
+#if defined(__linux__)
+        timespec ts{};
+        timespec* timeout = nullptr;
+        if (!deadline.infinite()) {
+            const auto ns = deadline.remaining().count();
+            ts.tv_sec = static_cast<time_t>(ns / 1'000'000'000);
+            ts.tv_nsec = static_cast<long>(ns % 1'000'000'000);
+            timeout = &ts;
         }
+        ::syscall(SYS_futex, &epoch_, FUTEX_WAIT_PRIVATE, key, timeout, nullptr, 0);
+#else
+        if (deadline.infinite()) {
+            epoch_.wait(key, std::memory_order_acquire);
+        } else {
+            std::this_thread::sleep_for(std::min<std::chrono::nanoseconds>(deadline.remaining(),
+                                                                           std::chrono::microseconds(50)));
+        }
+#endif
+    }
 
-        auto idx = head & MASK;
-        const auto* data = buffer_.data();
-
-        while (avail != 0) {
-            const auto contiguous = std::min<std::uint64_t>(avail, CAPACITY - idx);
-            const auto* ptr = data + idx;
-            const auto* end = ptr + contiguous;
+    void wake() noexcept {
+#if defined(__linux__)
+        ::syscall(SYS_futex, &epoch_, FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+#else
+        epoch_.notify_all();
+#endif
+    }
 
-            // Prefetch the next chunk if we will wrap.
-            if (avail > contiguous) {
-                detail::prefetch(data, false);
-            }
+    std::atomic<std::uint32_t> epoch_{0};
+    // Sleeping waiters, plus fd_armed and parent_armed.
+    std::atomic<std::uint32_t> state_{0};
+    int fd_ = -1;
+    EventCount* parent_ = nullptr;
+};
 
-            for (; ptr != end; ++ptr) {
-                handler.process(ptr);
-            }
+// A Channel's bit in a Poller's readiness word. Poller::add() sets it
+// while producers may be running, hence the atomic pointer; mask is
+// written before it is published.
+struct ChannelLink {
+    std::atomic<std::atomic<std::uint64_t>*> word{nullptr};
+    std::uint64_t mask = 0;
+
+    // Run after raising a group bit from clear; pairs with the barrier in
+    // Poller::poll(), one level up from the group bit protocol.
+    void raise() const noexcept {
+        light_barrier();
+        auto* w = word.load(std::memory_order_acquire);
+        if (w != nullptr && (w->load(std::memory_order_relaxed) & mask) == 0) {
+            w->fetch_or(mask, std::memory_order_release);
+        }
+    }
+};
+
+// Runs after every tail publication: wakes the consumer's EventCount (the
+// ring's own, or its Channel's) and raises the ring's bit in the Channel's
+// ready bitmap. One barrier orders the tail store against both loads.
+struct ReadableSignal {
+    EventCount* event = nullptr;
+    std::atomic<std::uint64_t>* ready_word = nullptr;
+    std::uint64_t ready_mask = 0;
+    std::atomic<std::uint64_t>* group_word = nullptr;
+    std::uint64_t group_mask = 0;
+    const ChannelLink* link = nullptr;
+
+    void operator()() const noexcept {
+        light_barrier();
+        event->notify_after_barrier();
+        if (ready_word != nullptr && (ready_word->load(std::memory_order_relaxed) & ready_mask) == 0) {
+            ready_word->fetch_or(ready_mask, std::memory_order_release);
+            // Only a bit raised here can find its word's group bit cleared;
+            // pairs with the consumer's barrier in BasicChannel::note_poll().
+            light_barrier();
+            if ((group_word->load(std::memory_order_relaxed) & group_mask) == 0) {
+                group_word->fetch_or(group_mask, std::memory_order_release);
+                link->raise();
+            }
+        }
+    }
+};
+
+// Ownership flag through which several consumer threads take turns on one
+// ring. acquire/release hand the consumer-private indices over with it.
+class Lease {
+public:
+    [[nodiscard]] bool try_acquire() noexcept {
+        return !held_.load(std::memory_order_relaxed) && !held_.exchange(true, std::memory_order_acquire);
+    }
+
+    void release() noexcept { held_.store(false, std::memory_order_release); }
+
+private:
+    std::atomic<bool> held_{false};
+};
+
+// Runs attempt() until it yields a truthy result, spinning with Backoff
+// first and then parking on event. Once done() reports that nothing more
+// can arrive, or the deadline passes, returns one last attempt().
+template <typename Attempt, typename Done>
+auto wait_for(EventCount& event, std::chrono::nanoseconds timeout, Attempt&& attempt, Done&& done) {
+    const Deadline deadline(timeout);
+    Backoff backoff;
+    while (true) {
+        if (auto r = attempt()) {
+            return r;
+        }
+        if (done() || deadline.expired()) {
+            return attempt();
+        }
+        if (!backoff.is_completed()) {
+            backoff.snooze();
+            continue;
+        }
+
+        const auto key = event.prepare_wait();
+        if (auto r = attempt()) {
+            event.cancel_wait();
+            return r;
+        }
+        if (done()) {
+            event.cancel_wait();
+            return attempt();
+        }
+        if (!event.wait(key, deadline)) {
+            return attempt();
+        }
+    }
+}
+
+} // namespace detail
+
+// ---------------------------------------------------------------------------
+// Metrics
+// ---------------------------------------------------------------------------
+
+struct Metrics {
+    std::uint64_t messages_sent = 0;
+    std::uint64_t messages_received = 0;
+    std::uint64_t batches_sent = 0;
+    std::uint64_t batches_received = 0;
+    std::uint64_t reserve_spins = 0;
+    std::uint64_t overruns = 0;  // Items an OverwriteRing consumer was lapped on
+    std::uint64_t drops = 0;     // Items rejected by a full Config::drop_newest ring
+};
+
+// ---------------------------------------------------------------------------
+// Reservation handle (zero-copy)
+// ---------------------------------------------------------------------------
+
+// For non-trivial T (see detail::trivial_slot_v) the slots are raw storage:
+// construct each one (std::construct_at) before commit, or use emplace().
+template <typename T>
+struct Reservation {
+    std::span<T> slice;
+    std::uint64_t pos = 0;
+};
+
+// ---------------------------------------------------------------------------
+// NUMA placement
+// ---------------------------------------------------------------------------
+
+// Where a producer's ring (slots and index cache lines) should live. Node
+// placement is preferred rather than strict, so a full node degrades to
+// remote memory instead of failing the allocation.
+struct Placement {
+    enum class Policy : std::uint8_t {
+        Default,    // first-touch, wherever the pages fault in
+        Local,      // node of the thread calling register_producer()
+        Node,       // an explicit node, e.g. the consumer's
+        Interleave, // spread pages across every allowed node
+    };
+
+    Policy policy = Policy::Default;
+    int node = 0;
+
+    static constexpr Placement local() noexcept { return {.policy = Policy::Local}; }
+    static constexpr Placement on_node(int n) noexcept { return {.policy = Policy::Node, .node = n}; }
+    static constexpr Placement interleaved() noexcept { return {.policy = Policy::Interleave}; }
+
+    friend constexpr bool operator==(const Placement&, const Placement&) = default;
+};
+
+// NUMA node of the calling thread (0 when unknown).
+inline int current_numa_node() noexcept {
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+        return static_cast<int>(node);
+    }
+#endif
+    return 0;
+}
+
+namespace detail {
+
+// Applies placement to the pages covering [addr, addr + bytes) and migrates
+// any already touched. Best effort: returns false where mbind is unavailable.
+inline bool bind_memory(const void* addr, std::size_t bytes, const Placement& placement) noexcept {
+    if (placement.policy == Placement::Policy::Default || bytes == 0) {
+        return true;
+    }
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_get_mempolicy)
+    constexpr int mpol_preferred = 1;
+    constexpr int mpol_interleave = 3;
+    constexpr unsigned long mpol_f_mems_allowed = 1UL << 2;
+    constexpr unsigned long mpol_mf_move = 1UL << 1;
+    constexpr std::size_t max_nodes = 1024;
+    constexpr std::size_t bits_per_word = sizeof(unsigned long) * 8;
+
+    std::array<unsigned long, max_nodes / bits_per_word> mask{};
+    int mode = mpol_preferred;
+    if (placement.policy == Placement::Policy::Interleave) {
+        if (::syscall(SYS_get_mempolicy, nullptr, mask.data(), max_nodes, nullptr, mpol_f_mems_allowed) != 0) {
+            return false;
+        }
+        mode = mpol_interleave;
+    } else {
+        const auto node = static_cast<std::size_t>(
+            placement.policy == Placement::Policy::Local ? current_numa_node() : placement.node);
+        if (node >= max_nodes) {
+            return false;
+        }
+        mask[node / bits_per_word] |= 1UL << (node % bits_per_word);
+    }
+
+    const auto begin = reinterpret_cast<std::uintptr_t>(addr) & ~(std::uintptr_t{page_size} - 1);
+    const auto end = round_up(reinterpret_cast<std::uintptr_t>(addr) + bytes, page_size);
+    return ::syscall(SYS_mbind, begin, end - begin, mode, mask.data(), max_nodes + 1, mpol_mf_move) == 0;
+#else
+    (void)addr;
+    return false;
+#endif
+}
+
+// Hooks through which a BasicChannel drives its rings, shared by every ring
+// type it can hold. Ring is the deriving ring, which runs readable_signal_()
+// after each publication. What the producer reads on every publication and
+// what the consumer writes on every poll live on separate lines.
+template <typename Ring>
+class ChannelHooks {
+public:
+    ChannelHooks(const ChannelHooks&) = delete;
+    ChannelHooks& operator=(const ChannelHooks&) = delete;
+
+    void mark_active() noexcept { active_.store(true, std::memory_order_release); }
+
+    // Redirects consumer wake-ups to an event shared by several rings (the
+    // owning Channel's). Must be set before the producer starts.
+    void set_readable_event(EventCount& event) noexcept { readable_signal_.event = &event; }
+
+    // The ring's bit in the owning Channel's ready bitmap, and that word's
+    // bit in the group bitmap above it, raised by the producer after a
+    // publication finds them clear (a raised group bit also raises the
+    // channel's Poller bit through link). Set before the producer starts.
+    void set_ready_bit(std::atomic<std::uint64_t>& word, std::uint64_t mask, std::atomic<std::uint64_t>& group,
+                       std::uint64_t group_mask, const ChannelLink& link) noexcept {
+        readable_signal_.ready_word = &word;
+        readable_signal_.ready_mask = mask;
+        readable_signal_.group_word = &group;
+        readable_signal_.group_mask = group_mask;
+        readable_signal_.link = &link;
+    }
+
+    // Consumer ownership for multi-consumer channels: only the holder of
+    // the lease may consume.
+    [[nodiscard]] bool try_lease() noexcept { return lease_.try_acquire(); }
+    void release_lease() noexcept { lease_.release(); }
+
+    // Consecutive empty polls, counted by the owning Channel's consumer.
+    [[nodiscard]] std::uint32_t& idle_polls() noexcept { return idle_polls_; }
+
+    // Channel deregistration. The producer's last call is retire(): its
+    // items are published and the consumer is pointed at the ring, which
+    // the owning Channel recycles once it has drained it. revive() readies
+    // the ring for the next producer of the slot.
+    void retire() noexcept {
+        retired_.store(true, std::memory_order_release);
+        readable_signal_();
+    }
+    [[nodiscard]] bool is_retired() const noexcept { return retired_.load(std::memory_order_acquire); }
+    void revive() noexcept { retired_.store(false, std::memory_order_relaxed); }
+
+    // Moves the ring object according to placement.
+    bool place(const Placement& placement) noexcept {
+        return bind_memory(static_cast<Ring*>(this), sizeof(Ring), placement);
+    }
+
+protected:
+    ChannelHooks() = default;
+    ~ChannelHooks() = default;
+
+    // Read by the producer on every publication. The consumer writes the
+    // event only when it goes to sleep.
+    alignas(128) ReadableSignal readable_signal_{.event = &own_readable_event_};
+    EventCount own_readable_event_;  // Sleeping consumer, unless redirected
+    std::atomic<bool> active_{false};
+    std::atomic<bool> retired_{false};
+
+    // Written by the consumer on every poll.
+    alignas(128) Lease lease_;
+    std::uint32_t idle_polls_{0};
+};
+
+} // namespace detail
+
+// ---------------------------------------------------------------------------
+// SPSC Ring Buffer
+// ---------------------------------------------------------------------------
+
+// BasicRing holds the SPSC protocol; Storage supplies the slots. Ring keeps
+// them inline with a compile-time capacity, DynamicRing allocates them
+// separately with a capacity chosen at construction.
+//
+// Trivial T takes the memcpy path. Any other T (std::string, std::unique_ptr,
+// ...) is constructed in place by emplace()/send(), handed to consume_batch
+// handlers as a mutable T* so it can be moved from, and destroyed as the head
+// passes it.
+
+template <typename T, Config config, typename Storage>
+class BasicRing : public detail::ChannelHooks<BasicRing<T, config, Storage>> {
+    using Hooks = detail::ChannelHooks<BasicRing>;
+    using Hooks::readable_signal_;
+
+public:
+    using value_type = T;
+
+    // What consume_batch hands to handler.process(): a pointer per item, or
+    // a span per contiguous run if the handler accepts one.
+    using item_pointer = std::conditional_t<detail::trivial_slot_v<T>, const T*, T*>;
+    using item_span = std::span<std::remove_pointer_t<item_pointer>>;
+
+    BasicRing() = default;
+
+    template <typename... Args>
+    explicit BasicRing(std::in_place_t, Args&&... args) : storage_(std::forward<Args>(args)...) {}
+
+    BasicRing(const BasicRing&) = delete;
+    BasicRing& operator=(const BasicRing&) = delete;
+
+    ~BasicRing() = default;
+    ~BasicRing() requires(!std::is_trivially_destructible_v<T>) {
+        destroy_items(read_pos_, write_pos_ - read_pos_);
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return storage_.capacity(); }
+    [[nodiscard]] std::size_t mask() const noexcept { return storage_.mask(); }
+
+    [[nodiscard]] std::size_t len() const noexcept {
+        const auto t = tail_.load(std::memory_order_relaxed);
+        const auto h = head_.load(std::memory_order_relaxed);
+        return detail::narrow_cast<std::size_t>(t - h);
+    }
+
+    [[nodiscard]] bool is_empty() const noexcept {
+        return tail_.load(std::memory_order_relaxed) == head_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool is_full() const noexcept { return len() >= capacity(); }
+
+    [[nodiscard]] bool is_closed() const noexcept { return closed_.load(std::memory_order_acquire); }
+
+    // Reserve n slots for zero-copy writing. Returns empty optional if
+    // full/closed; with config.drop_newest a full ring also counts n drops.
+    [[nodiscard]] std::optional<Reservation<T>> reserve(std::size_t n) noexcept {
+        if (n == 0 || n > capacity()) {
+            record_drop(n);
+            return std::nullopt;
+        }
+
+        const auto tail = write_pos_;
+
+        // Fast path: cached head
+        auto space = capacity() - detail::narrow_cast<std::size_t>(tail - cached_head_);
+        if (space >= n) {
+            return make_reservation(tail, n);
+        }
+
+        cached_head_ = head_.load(std::memory_order_acquire);
+        space = capacity() - detail::narrow_cast<std::size_t>(tail - cached_head_);
+        if (space < n || is_closed()) {
+            // The consumer cannot free space it has not been shown.
+            if constexpr (defers_tail) {
+                flush();
+            }
+            if (space < n) {
+                record_drop(n);
+            }
+            return std::nullopt;
+        }
+
+        return make_reservation(tail, n);
+    }
+
+    // Reserve with adaptive backoff. Spins then yields before giving up;
+    // a config.drop_newest ring makes a single attempt.
+    [[nodiscard]] std::optional<Reservation<T>> reserve_with_backoff(std::size_t n) noexcept {
+        if constexpr (config.drop_newest) {
+            return reserve(n);
+        }
+        Backoff backoff;
+        while (!backoff.is_completed()) {
+            if (auto r = reserve(n)) {
+                return r;
+            }
+            if (is_closed()) {
+                return std::nullopt;
+            }
+            backoff.snooze();
+        }
+        return std::nullopt;
+    }
+
+    // Commit n reserved slots. With config.tail_publish_every > 1 the tail is
+    // published every that many commits, once the ring is
+    // config.tail_publish_fill percent full, on a failed reserve, or on
+    // flush(); until then the consumer does not see the items.
+    //
+    // With config.sequence_stamps, the n items first take n consecutive
+    // tickets from the sequence counter in one fetch_add.
+    void commit(std::size_t n) noexcept {
+        if constexpr (config.sequence_stamps) {
+            auto seq = sequence_.source->fetch_add(n, std::memory_order_relaxed);
+            for (auto pos = write_pos_; pos != write_pos_ + n; ++pos) {
+                sequence_.stamps[pos & mask()] = seq++;
+            }
+        }
+        write_pos_ += detail::narrow_cast<std::uint64_t>(n);
+
+        if constexpr (defers_tail) {
+            if (++unpublished_commits_ >= config.tail_publish_every || past_fill_threshold()) {
+                publish_tail();
+            }
+        } else {
+            publish_tail();
+        }
+
+        if constexpr (config.enable_metrics) {
+            metrics_.messages_sent += n;
+            metrics_.batches_sent += 1;
+        }
+    }
+
+    // Publish every committed item to the consumer. Producers using deferred
+    // publication call this before going idle.
+    void flush() noexcept {
+        if constexpr (defers_tail) {
+            if (unpublished_commits_ != 0) {
+                publish_tail();
+            }
+        }
+    }
+
+    // Construct one item in place and publish it. Returns false if full/closed.
+    template <typename... Args>
+    bool emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+        auto r = reserve(1);
+        if (!r) {
+            return false;
+        }
+        std::construct_at(r->slice.data(), std::forward<Args>(args)...);
+        commit(1);
+        return true;
+    }
+
+    // Consumer API. The head is published per config.head_publish_every /
+    // head_publish_percent (see Config); with neither set, once per
+    // advance() or consume_batch() call. Pending head updates are also
+    // published whenever the consumer finds the ring empty.
+    [[nodiscard]] std::optional<std::span<const T>> readable() noexcept {
+        if (auto slots = readable_slots()) {
+            return std::span<const T>{*slots};
+        }
+        return std::nullopt;
+    }
+
+    // Everything published, as the run from the head up to the wrap and the
+    // run from the buffer start (empty unless the items wrap; always empty
+    // with mirrored storage). Both are empty if the ring is.
+    [[nodiscard]] std::array<std::span<const T>, 2> readable_all() noexcept {
+        const auto head = read_pos_;
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        if (cached_tail_ == head) {
+            if constexpr (strided_head) {
+                publish_head();
+            }
+            return {};
+        }
+        const auto avail = cached_tail_ - head;
+        const auto idx = head & mask();
+        const auto contiguous = contiguous_from(idx, avail);
+        const T* data = storage_.data();
+        return {std::span<const T>{data + idx, contiguous}, std::span<const T>{data, avail - contiguous}};
+    }
+
+    // Frees n items; non-trivial T is destroyed here.
+    void advance(std::size_t n) noexcept {
+        destroy_items(read_pos_, n);
+        read_pos_ += detail::narrow_cast<std::uint64_t>(n);
+        if (!strided_head || read_pos_ - head_.load(std::memory_order_relaxed) >= head_stride()) {
+            publish_head();
+        }
+
+        if constexpr (config.enable_metrics) {
+            metrics_.messages_received += n;
+            metrics_.batches_received += 1;
+        }
+    }
+
+    // Handlers taking item_span get each contiguous run in one call: at most
+    // two per batch, or one with mirrored storage (more only with a head
+    // publication stride). At most max_items are consumed. With
+    // config.sequence_stamps, a handler taking process(item, sequence) gets
+    // each item's stamp.
+    template <typename Handler>
+    std::size_t consume_batch(Handler&& handler, std::size_t max_items = SIZE_MAX) noexcept(
+        detail::nothrow_handler<std::remove_reference_t<Handler>, item_pointer, item_span>()) {
+        constexpr bool by_span = detail::span_handler<std::remove_reference_t<Handler>, item_span>;
+        constexpr bool by_sequence =
+            config.sequence_stamps && detail::sequenced_handler<std::remove_reference_t<Handler>, item_pointer>;
+        const auto deliver = [&](auto item) {
+            if constexpr (by_sequence) {
+                handler.process(item, sequence_of(item));
+            } else {
+                handler.process(item);
+            }
+        };
+        const auto head = read_pos_;
+        const auto published = tail_.load(std::memory_order_acquire);
+
+        if (head == published || max_items == 0) {
+            if constexpr (strided_head) {
+                publish_head();
+            }
+            return 0;
+        }
+        const auto tail = head + std::min<std::uint64_t>(published - head, max_items);
+
+        auto* data = storage_.data();
+        for (auto pos = head; pos != tail;) {
+            const auto idx = pos & mask();
+            auto run = contiguous_from(idx, tail - pos);
+            if constexpr (strided_head) {
+                run = std::min<std::uint64_t>(run, head_.load(std::memory_order_relaxed) + head_stride() - pos);
+            }
+            item_pointer ptr = data + idx;
+            item_pointer end = ptr + run;
+
+            // Prefetch the start of the next run (the buffer start on a wrap).
+            if (tail - pos > run) {
+                detail::prefetch(data + ((pos + run) & mask()), false);
+            }
+
+            if constexpr (detail::trivial_slot_v<T>) {
+                if constexpr (by_span) {
+                    handler.process(item_span{ptr, end});
+                } else {
+                    for (; ptr != end; ++ptr) {
+                        deliver(ptr);
+                    }
+                }
+            } else {
+                // Each item is destroyed once handed over. If the handler
+                // throws, the head stops at that item (or run) so nothing is
+                // destroyed twice and it is delivered again.
+                try {
+                    if constexpr (by_span) {
+                        handler.process(item_span{ptr, end});
+                        std::destroy(ptr, end);
+                        ptr = end;
+                    } else {
+                        for (; ptr != end; ++ptr) {
+                            deliver(ptr);
+                            std::destroy_at(ptr);
+                        }
+                    }
+                } catch (...) {
+                    read_pos_ = pos + detail::narrow_cast<std::uint64_t>(ptr - (data + idx));
+                    publish_head();
+                    throw;
+                }
+            }
+
+            pos += run;
+            if constexpr (strided_head) {
+                if (pos - head_.load(std::memory_order_relaxed) >= head_stride()) {
+                    read_pos_ = pos;
+                    publish_head();
+                }
+            }
+        }
+
+        read_pos_ = tail;
+        if constexpr (!strided_head) {
+            publish_head();
+        }
+
+        if constexpr (config.enable_metrics) {
+            metrics_.messages_received += detail::narrow_cast<std::size_t>(tail - head);
+            metrics_.batches_received += 1;
+        }
+
+        return detail::narrow_cast<std::size_t>(tail - head);
+    }
+
+    template <void (*Callback)(const T*)>
+    std::size_t consume_batch_fn() noexcept(noexcept(Callback(static_cast<const T*>(nullptr)))) {
+        struct Handler {
+            static void process(const T* item) { Callback(item); }
+        };
+        return consume_batch(Handler{});
+    }
+
+    // Convenience wrappers. Non-trivial T is copy-constructed into the slots
+    // by send() and moved out (then destroyed) by recv().
+    std::size_t send(std::span<const T> items) noexcept(std::is_nothrow_copy_constructible_v<T>) {
+        const auto r = reserve(items.size());
+        if (!r) {
+            return 0;
+        }
+        if constexpr (detail::trivial_slot_v<T>) {
+            std::ranges::copy(items.first(r->slice.size()), r->slice.begin());
+        } else {
+            std::uninitialized_copy_n(items.begin(), r->slice.size(), r->slice.begin());
+        }
+        commit(r->slice.size());
+        return r->slice.size();
+    }
+
+    std::size_t recv(std::span<T> out) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        auto slice = readable_slots();
+        if (!slice) {
+            return 0;
+        }
+        const auto n = std::min(slice->size(), out.size());
+        if constexpr (detail::trivial_slot_v<T>) {
+            std::ranges::copy(slice->first(n), out.begin());
+        } else {
+            std::ranges::move(slice->first(n), out.begin());
+        }
+        advance(n);
+        return n;
+    }
+
+    // Blocking variants: spin briefly, then sleep until the other side makes
+    // progress, the ring closes, or the timeout expires. The other side only
+    // issues a wake syscall while someone sleeps. Return 0 on timeout or
+    // once closed (and, for recv_wait, drained). A config.drop_newest
+    // producer never waits: send_wait() is send().
+    std::size_t send_wait(std::span<const T> items, std::chrono::nanoseconds timeout = wait_forever) noexcept(
+        noexcept(send(items))) {
+        if constexpr (config.drop_newest) {
+            return send(items);
+        }
+        items = items.first(std::min(items.size(), capacity()));
+        return detail::wait_for(writable_event_, timeout, [&] { return send(items); }, [&] { return is_closed(); });
+    }
+
+    std::size_t recv_wait(std::span<T> out, std::chrono::nanoseconds timeout = wait_forever) noexcept(
+        noexcept(recv(out))) {
+        return detail::wait_for(*readable_signal_.event, timeout, [&] { return recv(out); }, [&] { return is_closed(); });
+    }
+
+    void close() noexcept {
+        closed_.store(true, std::memory_order_release);
+        readable_signal_.event->notify();
+        writable_event_.notify();
+    }
+
+    // Items a config.drop_newest ring has rejected. Safe from any thread.
+    [[nodiscard]] std::uint64_t dropped() const noexcept {
+        if constexpr (config.drop_newest) {
+            return drops_.load(std::memory_order_relaxed);
+        }
+        return 0;
+    }
+
+    [[nodiscard]] Metrics get_metrics() const noexcept {
+        Metrics m{};
+        if constexpr (config.enable_metrics) {
+            m = metrics_;
+        }
+        m.drops = dropped();
+        return m;
+    }
+
+    // Config::sequence_stamps: draws tickets from a counter shared with
+    // other rings (the owning Channel's). Set before the producer starts.
+    void set_sequence_source(std::atomic<std::uint64_t>& counter) noexcept requires(config.sequence_stamps) {
+        sequence_.source = &counter;
+    }
+
+    // Stamp of a readable item (from readable() or a consume_batch handler).
+    [[nodiscard]] std::uint64_t sequence_of(const T* item) const noexcept requires(config.sequence_stamps) {
+        const auto idx = detail::narrow_cast<std::size_t>(item - storage_.data());
+        return sequence_.stamps[idx & mask()];
+    }
+
+    // Stamp of the oldest unconsumed item, if any.
+    [[nodiscard]] std::optional<std::uint64_t> head_sequence() noexcept requires(config.sequence_stamps) {
+        if (read_pos_ == tail_.load(std::memory_order_acquire)) {
+            return std::nullopt;
+        }
+        return sequence_.stamps[read_pos_ & mask()];
+    }
+
+    // Readable items from the head stamped first, first + 1, ... up to the
+    // first gap.
+    [[nodiscard]] std::size_t sequenced_run(std::uint64_t first) noexcept requires(config.sequence_stamps) {
+        const auto tail = tail_.load(std::memory_order_acquire);
+        auto pos = read_pos_;
+        while (pos != tail && sequence_.stamps[pos & mask()] == first + (pos - read_pos_)) {
+            ++pos;
+        }
+        return detail::narrow_cast<std::size_t>(pos - read_pos_);
+    }
+
+    // Deferred items are published before the ring is handed back.
+    void retire() noexcept {
+        flush();
+        Hooks::retire();
+    }
+
+    // Moves the index cache lines and the slots according to placement.
+    bool place(const Placement& placement) noexcept {
+        bool ok = Hooks::place(placement);
+        if constexpr (requires { storage_.bytes(); }) {
+            ok = detail::bind_memory(storage_.data(), storage_.bytes(), placement) && ok;
+        }
+        return ok;
+    }
+
+private:
+    static constexpr bool defers_tail = config.tail_publish_every > 1;
+
+    // Single writer, so a plain release store publishes; no RMW needed.
+    void publish_tail() noexcept {
+        tail_.store(write_pos_, std::memory_order_release);
+        if constexpr (defers_tail) {
+            unpublished_commits_ = 0;
+        }
+        readable_signal_();
+    }
+
+    // Single writer: a plain store on the producer's own line, no RMW.
+    void record_drop(std::size_t n) noexcept {
+        if constexpr (config.drop_newest) {
+            drops_.store(drops_.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] std::uint64_t tail_fill_threshold() const noexcept {
+        return std::max<std::uint64_t>(capacity() * config.tail_publish_fill / 100, 1);
+    }
+
+    // cached_head_ only moves on a failed reserve, so it overstates the fill
+    // after the first lap; reload the head before trusting it.
+    [[nodiscard]] bool past_fill_threshold() noexcept {
+        if (write_pos_ - cached_head_ < tail_fill_threshold()) {
+            return false;
+        }
+        cached_head_ = head_.load(std::memory_order_acquire);
+        return write_pos_ - cached_head_ >= tail_fill_threshold();
+    }
+
+    static constexpr bool strided_head = config.head_publish_every != 0 || config.head_publish_percent != 0;
+
+    // Items consumed per head publication when strided_head is set.
+    [[nodiscard]] std::uint64_t head_stride() const noexcept {
+        if constexpr (config.head_publish_every != 0) {
+            return config.head_publish_every;
+        } else {
+            return std::max<std::uint64_t>(capacity() * config.head_publish_percent / 100, 1);
+        }
+    }
+
+    void publish_head() noexcept {
+        head_.store(read_pos_, std::memory_order_release);
+        writable_event_.notify();
+    }
+
+    [[nodiscard]] std::optional<std::span<T>> readable_slots() noexcept {
+        const auto head = read_pos_;
+
+        // advance() may have moved head past a stale cached tail.
+        if (cached_tail_ <= head) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (cached_tail_ == head) {
+                if constexpr (strided_head) {
+                    publish_head();
+                }
+                return std::nullopt;
+            }
+        }
+        const auto avail = cached_tail_ - head;
+
+        const auto idx = head & mask();
+        const auto contiguous = contiguous_from(idx, avail);
+
+        const auto next_idx = (head + contiguous) & mask();
+        detail::prefetch(storage_.data() + next_idx, false);
+
+        return std::span<T>{storage_.data() + idx, storage_.data() + idx + contiguous};
+    }
+
+    void destroy_items(std::uint64_t from, std::uint64_t n) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (; n != 0; ++from, --n) {
+                std::destroy_at(storage_.data() + (from & mask()));
+            }
+        }
+    }
+
+    // Slots readable or writable in one span starting at idx. Mirrored
+    // storage never splits, so the wrap branch folds away.
+    template <typename N>
+    [[nodiscard]] N contiguous_from(std::uint64_t idx, N n) const noexcept {
+        if constexpr (Storage::mirrored) {
+            return n;
+        } else {
+            return std::min<N>(n, detail::narrow_cast<N>(capacity() - idx));
+        }
+    }
+
+    [[nodiscard]] std::optional<Reservation<T>> make_reservation(std::uint64_t tail, std::size_t n) noexcept {
+        const auto idx = tail & mask();
+        const auto contiguous = contiguous_from(idx, n);
+
+        const auto next_idx = (tail + n) & mask();
+        detail::prefetch(storage_.data() + next_idx, true);
+
+        return Reservation<T>{
+            .slice = std::span<T>{storage_.data() + idx, contiguous},
+            .pos = tail,
+        };
+    }
+
+    // Published tail, read by the consumer.
+    alignas(128) std::atomic<std::uint64_t> tail_{0};
+
+    // Producer-private, kept off the line the consumer polls.
+    alignas(128) std::uint64_t write_pos_{0};
+    std::uint64_t cached_head_{0};
+    std::size_t unpublished_commits_{0};
+    [[no_unique_address]] std::conditional_t<config.drop_newest, std::atomic<std::uint64_t>, std::monostate> drops_{};
+
+    alignas(128) std::atomic<std::uint64_t> head_{0};
+    std::uint64_t read_pos_{0};
+    std::uint64_t cached_tail_{0};
+
+    alignas(128) std::atomic<bool> closed_{false};
+    [[no_unique_address]] std::conditional_t<config.enable_metrics, Metrics, std::monostate> metrics_{};
+
+    // Sleeping producer.
+    alignas(128) detail::EventCount writable_event_;
+
+    alignas(128) Storage storage_;
+    [[no_unique_address]] detail::SequenceStamps<config.sequence_stamps> sequence_{storage_.capacity()};
+};
+
+template <typename T, Config config = default_config>
+class Ring : public BasicRing<T, config, detail::InlineStorage<T, std::size_t{1} << config.ring_bits>> {
+    static_assert(config.ring_bits < (sizeof(std::size_t) * 8), "ring_bits too large");
+    static_assert(detail::is_power_of_two(std::size_t{1} << config.ring_bits), "ring size must be power of two");
+    static_assert(config.memory != MemoryPolicy::Mirrored, "MemoryPolicy::Mirrored requires DynamicRing");
+
+public:
+    // Policy the owning Channel uses when it allocates the ring, since the
+    // slots live inside the ring object.
+    static constexpr MemoryPolicy object_memory = config.memory;
+
+    static constexpr std::size_t capacity() noexcept { return CAPACITY; }
+    static constexpr std::size_t mask() noexcept { return MASK; }
+
+    Ring() = default;
+
+private:
+    static constexpr std::size_t CAPACITY = std::size_t{1} << config.ring_bits;
+    static constexpr std::size_t MASK = CAPACITY - 1;
+};
+
+// Ring whose capacity is picked at runtime (rounded up to a power of two,
+// and to whole pages under MemoryPolicy::Mirrored). config.ring_bits only
+// supplies the default capacity.
+template <typename T, Config config = default_config>
+class DynamicRing : public BasicRing<T, config, detail::heap_storage_t<T, config.memory>> {
+    using Base = BasicRing<T, config, detail::heap_storage_t<T, config.memory>>;
+
+public:
+    // The slots are a separate config.memory allocation; the ring object
+    // itself is small.
+    static constexpr MemoryPolicy object_memory = MemoryPolicy::Heap;
+
+    explicit DynamicRing(std::size_t capacity = std::size_t{1} << config.ring_bits)
+        : Base(std::in_place, capacity) {}
+};
+
+// ---------------------------------------------------------------------------
+// Byte Ring (variable-length records)
+// ---------------------------------------------------------------------------
+
+// SPSC ring of length-prefixed records. Each record is an 8-byte header
+// followed by its payload, padded to 8 bytes. A record that would straddle
+// the end of the buffer is preceded by a padding record filling the rest, so
+// every payload is contiguous. Capacity is in bytes: 1 << config.ring_bits.
+template <Config config = default_config>
+class ByteRing : public detail::ChannelHooks<ByteRing<config>> {
+    using Hooks = detail::ChannelHooks<ByteRing>;
+    using Hooks::readable_signal_;
+
+    static_assert(config.ring_bits >= 4 && config.ring_bits < 32, "ring_bits out of range for a byte ring");
+    static_assert(config.memory != MemoryPolicy::Mirrored, "MemoryPolicy::Mirrored requires DynamicRing");
+    static_assert(!config.sequence_stamps, "sequence_stamps requires Ring or DynamicRing");
+
+public:
+    using value_type = std::byte;
+
+    static constexpr MemoryPolicy object_memory = config.memory;
+    static constexpr std::size_t record_alignment = 8;
+
+    static constexpr std::size_t capacity() noexcept { return CAPACITY; }
+
+    // Largest payload a single record can carry. Half the ring, so a record
+    // plus the padding that moves it past the end always fits a drained ring.
+    static constexpr std::size_t max_record() noexcept { return CAPACITY / 2 - sizeof(Header); }
+
+    ByteRing() = default;
+
+    ByteRing(const ByteRing&) = delete;
+    ByteRing& operator=(const ByteRing&) = delete;
+
+    // Bytes in flight, including headers and padding.
+    [[nodiscard]] std::size_t len() const noexcept {
+        const auto t = tail_.load(std::memory_order_relaxed);
+        const auto h = head_.load(std::memory_order_relaxed);
+        return detail::narrow_cast<std::size_t>(t - h);
+    }
+
+    [[nodiscard]] bool is_empty() const noexcept {
+        return tail_.load(std::memory_order_relaxed) == head_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool is_closed() const noexcept { return closed_.load(std::memory_order_acquire); }
+
+    // Reserve a record with room for `bytes` payload bytes. The slice is
+    // always contiguous. Returns empty optional if full/closed.
+    [[nodiscard]] std::optional<Reservation<std::byte>> reserve(std::size_t bytes) noexcept {
+        if (bytes == 0 || bytes > max_record()) {
+            return std::nullopt;
+        }
+
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        const auto idx = detail::narrow_cast<std::size_t>(tail & MASK);
+        const auto record = record_size(bytes);
+        const auto to_end = CAPACITY - idx;
+        const auto pad = record <= to_end ? 0 : to_end;
+        const auto need = pad + record;
+
+        if (CAPACITY - detail::narrow_cast<std::size_t>(tail - cached_head_) < need) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (CAPACITY - detail::narrow_cast<std::size_t>(tail - cached_head_) < need || is_closed()) {
+                return std::nullopt;
+            }
+        }
+
+        if (pad != 0) {
+            write_header(idx, Header{.length = detail::narrow_cast<std::uint32_t>(pad - sizeof(Header)),
+                                     .kind = Header::Padding});
+        }
+        pending_pad_ = pad;
+        pending_max_ = bytes;
+
+        const auto start = (idx + pad) & MASK;
+        return Reservation<std::byte>{
+            .slice = std::span<std::byte>{storage_.data() + start + sizeof(Header), bytes},
+            .pos = tail + pad,
+        };
+    }
+
+    // Reserve with adaptive backoff. Spins then yields before giving up.
+    [[nodiscard]] std::optional<Reservation<std::byte>> reserve_with_backoff(std::size_t bytes) noexcept {
+        Backoff backoff;
+        while (!backoff.is_completed()) {
+            if (auto r = reserve(bytes)) {
+                return r;
+            }
+            if (is_closed()) {
+                return std::nullopt;
+            }
+            backoff.snooze();
+        }
+        return std::nullopt;
+    }
+
+    // Publish the last reservation as a record of `bytes` payload bytes
+    // (at most what was reserved). Ignored if nothing is reserved.
+    void commit(std::size_t bytes) noexcept {
+        if (pending_max_ == 0) {
+            return;
+        }
+        bytes = std::min(bytes, pending_max_);
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        const auto start = detail::narrow_cast<std::size_t>((tail + pending_pad_) & MASK);
+        write_header(start, Header{.length = detail::narrow_cast<std::uint32_t>(bytes), .kind = Header::Data});
+        tail_.store(tail + pending_pad_ + record_size(bytes), std::memory_order_release);
+        pending_pad_ = 0;
+        pending_max_ = 0;
+        readable_signal_();
+
+        if constexpr (config.enable_metrics) {
+            metrics_.messages_sent += 1;
+            metrics_.batches_sent += 1;
+        }
+    }
+
+    // Consumer API: hands each record's payload to handler.process(span) in
+    // place, then frees the whole batch (at most max_records) with one head
+    // update.
+    template <typename Handler>
+    std::size_t consume_batch(Handler&& handler, std::size_t max_records = SIZE_MAX) noexcept(
+        noexcept(handler.process(std::span<const std::byte>{}))) {
+        const auto head = head_.load(std::memory_order_relaxed);
+        const auto tail = tail_.load(std::memory_order_acquire);
+        if (head == tail) {
+            return 0;
+        }
+
+        std::size_t records = 0;
+        auto pos = head;
+        while (pos != tail && records < max_records) {
+            const auto idx = detail::narrow_cast<std::size_t>(pos & MASK);
+            const auto header = read_header(idx);
+            if (header.kind == Header::Data) {
+                handler.process(std::span<const std::byte>{storage_.data() + idx + sizeof(Header), header.length});
+                ++records;
+                pos += record_size(header.length);
+            } else {
+                pos += sizeof(Header) + header.length;
+            }
+        }
+
+        head_.store(pos, std::memory_order_release);
+
+        if constexpr (config.enable_metrics) {
+            metrics_.messages_received += records;
+            metrics_.batches_received += 1;
+        }
+        return records;
+    }
+
+    // Copies `record` into the ring as one record. Returns bytes sent (0 if
+    // full, closed or too large).
+    std::size_t send(std::span<const std::byte> record) noexcept {
+        const auto r = reserve(record.size());
+        if (!r) {
+            return 0;
+        }
+        std::ranges::copy(record, r->slice.begin());
+        commit(record.size());
+        return record.size();
+    }
+
+    void close() noexcept {
+        closed_.store(true, std::memory_order_release);
+        readable_signal_.event->notify();
+    }
+
+    [[nodiscard]] Metrics get_metrics() const noexcept {
+        if constexpr (config.enable_metrics) {
+            return metrics_;
+        }
+        return Metrics{};
+    }
+
+private:
+    static constexpr std::size_t CAPACITY = std::size_t{1} << config.ring_bits;
+    static constexpr std::size_t MASK = CAPACITY - 1;
+
+    struct Header {
+        static constexpr std::uint32_t Data = 0;
+        static constexpr std::uint32_t Padding = 1;
+
+        std::uint32_t length;
+        std::uint32_t kind;
+    };
+    static_assert(sizeof(Header) == record_alignment);
+
+    static constexpr std::size_t record_size(std::size_t bytes) noexcept {
+        return sizeof(Header) + detail::round_up(bytes, record_alignment);
+    }
+
+    void write_header(std::size_t idx, Header header) noexcept {
+        std::memcpy(storage_.data() + idx, &header, sizeof(header));
+    }
+
+    [[nodiscard]] Header read_header(std::size_t idx) const noexcept {
+        Header header;
+        std::memcpy(&header, storage_.data() + idx, sizeof(header));
+        return header;
+    }
+
+    alignas(128) std::atomic<std::uint64_t> tail_{0};
+    std::uint64_t cached_head_{0};
+    std::size_t pending_pad_{0};
+    std::size_t pending_max_{0};
+
+    alignas(128) std::atomic<std::uint64_t> head_{0};
+
+    alignas(128) std::atomic<bool> closed_{false};
+    [[no_unique_address]] std::conditional_t<config.enable_metrics, Metrics, std::monostate> metrics_{};
+
+    alignas(128) detail::InlineStorage<std::byte, CAPACITY> storage_;
+};
+
+// ---------------------------------------------------------------------------
+// Overwrite Ring (lossy)
+// ---------------------------------------------------------------------------
+
+// SPSC ring whose producer never waits: once the ring is full each push
+// overwrites the oldest unread item. Every slot carries a sequence number
+// written seqlock-style around the payload, so the consumer copies an item
+// out, re-checks the sequence, and on a mismatch knows it was lapped: it
+// skips to the oldest item still present and adds the gap to overruns().
+// The producer never reads the head, so its cost does not depend on the
+// consumer. Handlers see a validated copy, hence T must be trivially
+// copyable.
+template <typename T, Config config = default_config>
+class OverwriteRing : public detail::ChannelHooks<OverwriteRing<T, config>> {
+    using Hooks = detail::ChannelHooks<OverwriteRing>;
+    using Hooks::readable_signal_;
+
+    static_assert(std::is_trivially_copyable_v<T>, "OverwriteRing requires trivially copyable T");
+    static_assert(config.ring_bits < (sizeof(std::size_t) * 8), "ring_bits too large");
+    static_assert(config.memory != MemoryPolicy::Mirrored, "MemoryPolicy::Mirrored requires DynamicRing");
+    static_assert(!config.sequence_stamps, "sequence_stamps requires Ring or DynamicRing");
+
+public:
+    using value_type = T;
+
+    static constexpr MemoryPolicy object_memory = config.memory;
+
+    static constexpr std::size_t capacity() noexcept { return CAPACITY; }
+    static constexpr std::size_t mask() noexcept { return MASK; }
+
+    OverwriteRing() = default;
+
+    OverwriteRing(const OverwriteRing&) = delete;
+    OverwriteRing& operator=(const OverwriteRing&) = delete;
+
+    // Published but not yet consumed, capped at capacity().
+    [[nodiscard]] std::size_t len() const noexcept {
+        const auto t = tail_.load(std::memory_order_relaxed);
+        const auto h = head_.load(std::memory_order_relaxed);
+        return detail::narrow_cast<std::size_t>(std::min<std::uint64_t>(t - h, CAPACITY));
+    }
+
+    [[nodiscard]] bool is_empty() const noexcept {
+        return tail_.load(std::memory_order_relaxed) == head_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool is_closed() const noexcept { return closed_.load(std::memory_order_acquire); }
+
+    // Always succeeds unless the ring is closed.
+    bool push(const T& item) noexcept {
+        if (is_closed()) {
+            return false;
+        }
+        write(item);
+        publish();
+
+        if constexpr (config.enable_metrics) {
+            metrics_.messages_sent += 1;
+            metrics_.batches_sent += 1;
+        }
+        return true;
+    }
+
+    template <typename... Args>
+    bool emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+        return push(T(std::forward<Args>(args)...));
+    }
+
+    // Writes every item (only the last capacity() can survive), publishing
+    // the tail once. Returns 0 only when closed.
+    std::size_t send(std::span<const T> items) noexcept {
+        if (items.empty() || is_closed()) {
+            return 0;
+        }
+        for (const auto& item : items) {
+            write(item);
+        }
+        publish();
+
+        if constexpr (config.enable_metrics) {
+            metrics_.messages_sent += items.size();
+            metrics_.batches_sent += 1;
+        }
+        return items.size();
+    }
+
+    // Consumer API: each surviving item is copied out and validated before
+    // handler.process(const T*) sees it; the head is published once.
+    template <typename Handler>
+    std::size_t consume_batch(Handler&& handler, std::size_t max_items = SIZE_MAX) noexcept(
+        noexcept(handler.process(static_cast<const T*>(nullptr)))) {
+        std::size_t delivered = 0;
+        drain(max_items, [&](const T& item) {
+            handler.process(&item);
+            ++delivered;
+        });
+        return delivered;
+    }
+
+    std::size_t recv(std::span<T> out) noexcept {
+        std::size_t n = 0;
+        drain(out.size(), [&](const T& item) { out[n++] = item; });
+        return n;
+    }
+
+    // Items lost to the producer lapping the consumer (consumer thread).
+    [[nodiscard]] std::uint64_t overruns() const noexcept { return overruns_; }
+
+    void close() noexcept {
+        closed_.store(true, std::memory_order_release);
+        readable_signal_.event->notify();
+    }
+
+    [[nodiscard]] Metrics get_metrics() const noexcept {
+        Metrics m{};
+        if constexpr (config.enable_metrics) {
+            m = metrics_;
+        }
+        m.overruns = overruns_;
+        return m;
+    }
+
+private:
+    static constexpr std::size_t CAPACITY = std::size_t{1} << config.ring_bits;
+    static constexpr std::size_t MASK = CAPACITY - 1;
+
+    // seq is 2 * (pos + 1) once item pos is complete, odd while it is being
+    // written. The item is kept as bytes so T needs no default constructor.
+    using Bytes = std::array<std::byte, sizeof(T)>;
+    struct Slot {
+        std::atomic<std::uint64_t> seq{0};
+        alignas(T) Bytes value{};
+    };
+
+    static constexpr std::uint64_t complete_seq(std::uint64_t pos) noexcept { return 2 * (pos + 1); }
+
+    void write(const T& item) noexcept {
+        auto& slot = slots_[write_pos_ & MASK];
+        slot.seq.store(complete_seq(write_pos_) - 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(slot.value.data(), &item, sizeof(T));
+        slot.seq.store(complete_seq(write_pos_), std::memory_order_release);
+        ++write_pos_;
+    }
+
+    void publish() noexcept {
+        tail_.store(write_pos_, std::memory_order_release);
+        readable_signal_();
+    }
+
+    // Hands up to max validated items to sink, skipping anything the
+    // producer overwrote first.
+    template <typename Sink>
+    void drain(std::size_t max, Sink&& sink) {
+        auto pos = read_pos_;
+        auto tail = tail_.load(std::memory_order_acquire);
+        if (pos == tail) {
+            return;
+        }
+
+        std::size_t delivered = 0;
+        while (pos != tail && delivered < max) {
+            // Slots more than a lap behind the tail are gone for certain.
+            if (tail - pos > CAPACITY) {
+                overruns_ += tail - CAPACITY - pos;
+                pos = tail - CAPACITY;
+            }
+
+            const auto& slot = slots_[pos & MASK];
+            const auto expected = complete_seq(pos);
+            Bytes bytes;
+            const auto before = slot.seq.load(std::memory_order_acquire);
+            std::memcpy(bytes.data(), slot.value.data(), sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const auto after = slot.seq.load(std::memory_order_relaxed);
+
+            if (before != expected || after != expected) {
+                // Overwritten, possibly mid-copy: the producer has started
+                // pos + CAPACITY, so pos is lost. Catch up with the tail.
+                tail = tail_.load(std::memory_order_acquire);
+                overruns_ += 1;
+                ++pos;
+                continue;
+            }
+
+            ++pos;
+            ++delivered;
+            sink(std::bit_cast<T>(bytes));
+        }
+
+        read_pos_ = pos;
+        head_.store(pos, std::memory_order_release);
+
+        if constexpr (config.enable_metrics) {
+            metrics_.messages_received += delivered;
+            metrics_.batches_received += 1;
+        }
+    }
+
+    alignas(128) std::atomic<std::uint64_t> tail_{0};
+    std::uint64_t write_pos_{0};
+
+    alignas(128) std::atomic<std::uint64_t> head_{0};
+    std::uint64_t read_pos_{0};
+    std::uint64_t overruns_{0};
+
+    alignas(128) std::atomic<bool> closed_{false};
+    [[no_unique_address]] std::conditional_t<config.enable_metrics, Metrics, std::monostate> metrics_{};
+
+    alignas(128) std::array<Slot, CAPACITY> slots_{};
+};
+
+// ---------------------------------------------------------------------------
+// Broadcast Ring (SPMC)
+// ---------------------------------------------------------------------------
+
+// One producer, up to config.max_consumers independent readers, each item
+// written once. Every consumer owns a read cursor on its own cache line and
+// sees every item in order; the producer's free space comes from the
+// slowest active cursor, cached like Ring's cached_head_ and refreshed only
+// when it runs out. Consumers register before the first reserve(); a
+// consumer that detach()es stops holding the producer back.
+template <typename T, Config config = default_config>
+class BroadcastRing {
+    static_assert(std::is_trivially_copyable_v<T>, "BroadcastRing requires trivially copyable T");
+    static_assert(config.ring_bits < (sizeof(std::size_t) * 8), "ring_bits too large");
+    static_assert(config.max_consumers > 0, "max_consumers must be positive");
+    static_assert(config.memory != MemoryPolicy::Mirrored, "MemoryPolicy::Mirrored requires DynamicRing");
+    static_assert(!config.sequence_stamps, "sequence_stamps requires Ring or DynamicRing");
+
+public:
+    using value_type = T;
+    using item_pointer = const T*;
+    using item_span = std::span<const T>;
+
+    static constexpr std::size_t capacity() noexcept { return CAPACITY; }
+    static constexpr std::size_t mask() noexcept { return MASK; }
+
+    class Consumer {
+    public:
+        [[nodiscard]] std::size_t id() const noexcept { return id_; }
+
+        // Published items this consumer has not read yet.
+        [[nodiscard]] std::size_t len() const noexcept {
+            return detail::narrow_cast<std::size_t>(ring_->tail_.load(std::memory_order_relaxed) -
+                                                    cursor().head.load(std::memory_order_relaxed));
+        }
+
+        // Same handler forms as Ring::consume_batch(); one head update per call.
+        template <typename Handler>
+        std::size_t consume_batch(Handler&& handler) noexcept(
+            detail::nothrow_handler<std::remove_reference_t<Handler>, item_pointer, item_span>()) {
+            constexpr bool by_span = detail::span_handler<std::remove_reference_t<Handler>, item_span>;
+            auto& c = cursor();
+            const auto head = c.head.load(std::memory_order_relaxed);
+            const auto tail = ring_->tail_.load(std::memory_order_acquire);
+            if (head == tail) {
+                return 0;
+            }
+
+            const T* data = ring_->storage_.data();
+            for (auto pos = head; pos != tail;) {
+                const auto idx = pos & MASK;
+                const auto run = std::min<std::uint64_t>(tail - pos, CAPACITY - idx);
+                if constexpr (by_span) {
+                    handler.process(item_span{data + idx, run});
+                } else {
+                    for (const T* ptr = data + idx; ptr != data + idx + run; ++ptr) {
+                        handler.process(ptr);
+                    }
+                }
+                pos += run;
+            }
+
+            c.head.store(tail, std::memory_order_release);
+            return detail::narrow_cast<std::size_t>(tail - head);
+        }
+
+        std::size_t recv(std::span<T> out) noexcept {
+            auto& c = cursor();
+            const auto head = c.head.load(std::memory_order_relaxed);
+            const auto avail = ring_->tail_.load(std::memory_order_acquire) - head;
+            const auto n = detail::narrow_cast<std::size_t>(std::min<std::uint64_t>(avail, out.size()));
+            for (std::size_t i = 0; i < n; ++i) {
+                out[i] = ring_->storage_.data()[(head + i) & MASK];
+            }
+            c.head.store(head + n, std::memory_order_release);
+            return n;
+        }
+
+        // Stops gating the producer; the cursor is not reused.
+        void detach() noexcept { cursor().active.store(false, std::memory_order_release); }
+
+    private:
+        friend class BroadcastRing;
+
+        Consumer(BroadcastRing* ring, std::size_t id) noexcept : ring_(ring), id_(id) {}
+
+        [[nodiscard]] auto& cursor() const noexcept { return ring_->cursors_[id_]; }
+
+        BroadcastRing* ring_;
+        std::size_t id_;
+    };
+
+    enum class RegisterError { TooManyConsumers, Started };
+    using RegisterResult = std::expected<Consumer, RegisterError>;
+
+    BroadcastRing() = default;
+
+    BroadcastRing(const BroadcastRing&) = delete;
+    BroadcastRing& operator=(const BroadcastRing&) = delete;
+
+    [[nodiscard]] RegisterResult register_consumer() noexcept {
+        const auto id = consumer_count_.fetch_add(1, std::memory_order_relaxed);
+        if (id >= config.max_consumers) {
+            consumer_count_.fetch_sub(1, std::memory_order_relaxed);
+            return std::unexpected(RegisterError::TooManyConsumers);
+        }
+
+        // Pairs with the seq_cst store in refresh_limit(): either the
+        // producer sees this cursor, or this sees that it already started.
+        cursors_[id].active.store(true, std::memory_order_seq_cst);
+        if (started_.load(std::memory_order_seq_cst)) {
+            cursors_[id].active.store(false, std::memory_order_relaxed);
+            return std::unexpected(RegisterError::Started);
+        }
+        return Consumer{this, id};
+    }
+
+    [[nodiscard]] std::size_t consumer_count() const noexcept {
+        return std::min(consumer_count_.load(std::memory_order_acquire), config.max_consumers);
+    }
+
+    [[nodiscard]] bool is_closed() const noexcept { return closed_.load(std::memory_order_acquire); }
+
+    void close() noexcept { closed_.store(true, std::memory_order_release); }
+
+    // Producer API, as on Ring.
+    [[nodiscard]] std::optional<Reservation<T>> reserve(std::size_t n) noexcept {
+        if (n == 0 || n > CAPACITY) {
+            return std::nullopt;
+        }
+        if (write_pos_ + n > limit_) {
+            refresh_limit();
+            if (write_pos_ + n > limit_ || is_closed()) {
+                return std::nullopt;
+            }
+        }
+
+        const auto idx = write_pos_ & MASK;
+        return Reservation<T>{
+            .slice = std::span<T>{storage_.data() + idx, std::min<std::size_t>(n, CAPACITY - idx)},
+            .pos = write_pos_,
+        };
+    }
+
+    void commit(std::size_t n) noexcept {
+        write_pos_ += detail::narrow_cast<std::uint64_t>(n);
+        tail_.store(write_pos_, std::memory_order_release);
+    }
+
+    std::size_t send(std::span<const T> items) noexcept {
+        const auto r = reserve(items.size());
+        if (!r) {
+            return 0;
+        }
+        std::ranges::copy(items.first(r->slice.size()), r->slice.begin());
+        commit(r->slice.size());
+        return r->slice.size();
+    }
+
+    template <typename... Args>
+    bool emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+        auto r = reserve(1);
+        if (!r) {
+            return false;
+        }
+        std::construct_at(r->slice.data(), std::forward<Args>(args)...);
+        commit(1);
+        return true;
+    }
+
+private:
+    static constexpr std::size_t CAPACITY = std::size_t{1} << config.ring_bits;
+    static constexpr std::size_t MASK = CAPACITY - 1;
+
+    struct alignas(128) Cursor {
+        std::atomic<std::uint64_t> head{0};
+        std::atomic<bool> active{false};
+    };
+
+    // With no active cursor nothing gates the producer.
+    void refresh_limit() noexcept {
+        if (!started_.load(std::memory_order_relaxed)) {
+            started_.store(true, std::memory_order_seq_cst);
+        }
+        auto slowest = write_pos_;
+        const auto count = consumer_count();
+        for (std::size_t i = 0; i < count; ++i) {
+            if (cursors_[i].active.load(std::memory_order_seq_cst)) {
+                slowest = std::min(slowest, cursors_[i].head.load(std::memory_order_acquire));
+            }
+        }
+        limit_ = slowest + CAPACITY;
+    }
+
+    alignas(128) std::atomic<std::uint64_t> tail_{0};
+
+    // Producer-private. limit_ is the cached slowest cursor plus capacity;
+    // 0 sends the first reserve() through refresh_limit().
+    alignas(128) std::uint64_t write_pos_{0};
+    std::uint64_t limit_{0};
+
+    alignas(128) std::atomic<std::size_t> consumer_count_{0};
+    std::atomic<bool> started_{false};
+    std::atomic<bool> closed_{false};
+
+    std::array<Cursor, config.max_consumers> cursors_{};
+
+    alignas(128) detail::InlineStorage<T, CAPACITY> storage_;
+};
+
+// ---------------------------------------------------------------------------
+// Channel (MPSC)
+// ---------------------------------------------------------------------------
+
+class Poller;
+
+// BasicChannel is shared by Channel, DynamicChannel and ByteChannel. Slots is a table of
+// ring pointers (std::array for Channel, a heap array sized at construction
+// for DynamicChannel). A ring is allocated only when register_producer()
+// hands out its slot, then published to the consumer with a release store;
+// slots that were never handed out cost one pointer each.
+
+template <typename RingT, Config config, typename Slots>
+class BasicChannel {
+    using T = typename RingT::value_type;
+    using RingType = RingT;
+
+public:
+    struct Producer {
+        RingType* ring = nullptr;
+        std::size_t id = 0;
+
+        [[nodiscard]] std::optional<Reservation<T>> reserve(std::size_t n) noexcept {
+            return ring->reserve(n);
+        }
+        [[nodiscard]] std::optional<Reservation<T>> reserve_with_backoff(std::size_t n) noexcept {
+            return ring->reserve_with_backoff(n);
+        }
+        void commit(std::size_t n) noexcept { ring->commit(n); }
+        void flush() noexcept { ring->flush(); }
+        std::size_t send(std::span<const T> items) noexcept(noexcept(ring->send(items))) { return ring->send(items); }
+        std::size_t send_wait(std::span<const T> items, std::chrono::nanoseconds timeout = wait_forever) noexcept(
+            noexcept(ring->send_wait(items, timeout))) {
+            return ring->send_wait(items, timeout);
+        }
+
+        template <typename... Args>
+        bool emplace(Args&&... args) noexcept(noexcept(ring->emplace(std::forward<Args>(args)...))) {
+            return ring->emplace(std::forward<Args>(args)...);
+        }
+    };
+
+    // Move-only Producer that deregisters on destruction; see
+    // deregister_producer(). Must not outlive the channel.
+    class ScopedProducer {
+    public:
+        ScopedProducer(ScopedProducer&& other) noexcept
+            : channel_(std::exchange(other.channel_, nullptr)), producer_(other.producer_) {}
+        ScopedProducer& operator=(ScopedProducer&& other) noexcept {
+            if (this != &other) {
+                reset();
+                channel_ = std::exchange(other.channel_, nullptr);
+                producer_ = other.producer_;
+            }
+            return *this;
+        }
+        ~ScopedProducer() { reset(); }
+
+        Producer& operator*() noexcept { return producer_; }
+        Producer* operator->() noexcept { return &producer_; }
+
+        // Deregisters now; the handle is empty afterwards.
+        void reset() noexcept {
+            if (channel_ != nullptr) {
+                std::exchange(channel_, nullptr)->deregister_producer(producer_);
+            }
+        }
+
+    private:
+        friend class BasicChannel;
+
+        ScopedProducer(BasicChannel* channel, Producer producer) noexcept : channel_(channel), producer_(producer) {}
+
+        BasicChannel* channel_;
+        Producer producer_;
+    };
+
+    // Multi-consumer mode: every consumer thread drains through its own
+    // Consumer instead of recv()/consume_all(). A ring is leased for one
+    // batch at a time, so it keeps a single reader and its FIFO order. Each
+    // pass starts at the ring that last had work for this consumer and
+    // scans the rest, so idle consumers steal whatever rings are hot.
+    class Consumer {
+    public:
+        template <typename Handler>
+        std::size_t consume(Handler&& handler) noexcept(noexcept(std::declval<RingType&>().consume_batch(handler))) {
+            return scan([&](RingType& ring, std::size_t quota, std::size_t) { return ring.consume_batch(handler, quota); },
+                        SIZE_MAX);
+        }
+
+        std::size_t recv(std::span<T> out) noexcept(noexcept(std::declval<RingType&>().recv(out))) {
+            return scan(
+                [&](RingType& ring, std::size_t quota, std::size_t total) {
+                    return ring.recv(out.subspan(total).first(std::min(out.size() - total, quota)));
+                },
+                out.size());
+        }
+
+    private:
+        friend class BasicChannel;
+
+        Consumer(BasicChannel* channel, std::size_t home) noexcept : channel_(channel), home_(home) {}
+
+        // drain(ring, quota, total so far) runs under the ring's lease.
+        template <typename Drain>
+        std::size_t scan(Drain&& drain, std::size_t limit) {
+            struct Release {
+                RingType* ring;
+                ~Release() { ring->release_lease(); }
+            };
+
+            const auto count = channel_->producer_count();
+            std::size_t total = 0;
+            if (count == 0 || limit == 0) {
+                return 0;
+            }
+            channel_->for_each_ready(
+                [&](std::size_t idx, RingType& ring) {
+                    if (!ring.try_lease()) {
+                        return true;
+                    }
+                    const Release release{&ring};
+                    const auto n = drain(ring, channel_->ring_quota(idx), total);
+                    channel_->note_poll(idx, ring, n);
+                    if (n != 0 && total == 0) {
+                        home_ = idx;
+                    }
+                    total += n;
+                    return total < limit;
+                },
+                home_ % count);
+            return total;
+        }
+
+        BasicChannel* channel_;
+        std::size_t home_;
+    };
+
+    enum class RegisterError { TooManyProducers, Closed, OutOfMemory };
+    using RegisterResult = std::expected<Producer, RegisterError>;
+
+    // One ring's readable items in lease_readable(): first runs from the
+    // head to the wrap, second continues from the buffer start (often
+    // empty). The caller sets consumed before release_readable().
+    struct ReadableRegion {
+        std::size_t producer_id = 0;
+        std::span<const T> first;
+        std::span<const T> second;
+        std::size_t consumed = 0;
+
+        [[nodiscard]] std::size_t size() const noexcept { return first.size() + second.size(); }
+    };
+
+    // A reserve_local() reservation, tagged with its ring so that
+    // commit_local() needs no second lookup.
+    struct LocalReservation : Reservation<T> {
+        RingType* ring = nullptr;
+    };
+
+    constexpr BasicChannel() = default;
+
+    explicit BasicChannel(std::size_t max_producers, std::size_t ring_capacity)
+        : slots_(max_producers),
+          ready_(detail::bitmap_words(max_producers, 0)),
+          groups_(detail::bitmap_words(max_producers, 1)),
+          free_(detail::bitmap_words(max_producers, 0)),
+          weights_(max_producers),
+          merge_heap_(max_producers),
+          regions_(max_producers),
+          ring_capacity_(ring_capacity) {}
+
+    BasicChannel(const BasicChannel&) = delete;
+    BasicChannel& operator=(const BasicChannel&) = delete;
+
+    ~BasicChannel() {
+        {
+            auto& registry = detail::LocalRegistry::instance();
+            const std::lock_guard lock(registry.mutex);
+            if (has_local_producers_) {
+                std::erase(registry.live, local_id_);
+            }
+        }
+        for (std::size_t i = 0; i < slots_.size(); ++i) {
+            detail::destroy<RingType, RingType::object_memory>(slots_[i].load(std::memory_order_relaxed));
+        }
+#if defined(__linux__)
+        if (notification_fd_ >= 0) {
+            ::close(notification_fd_);
+        }
+#endif
+    }
+
+    [[nodiscard]] std::size_t max_producers() const noexcept { return slots_.size(); }
+
+    // One per consumer thread; see Consumer. Homes start spread out.
+    [[nodiscard]] Consumer make_consumer() noexcept {
+        return Consumer{this, next_home_.fetch_add(1, std::memory_order_relaxed)};
+    }
 
-            avail -= contiguous;
-            idx = 0;
+    // placement is a best-effort NUMA hint for the new ring; the ring is
+    // bound before the producer sees it. Recycled slots (lowest id first)
+    // are reused before new ones, with their ring.
+    [[nodiscard]] RegisterResult register_producer(const Placement& placement = {}) noexcept {
+        if (closed_.load(std::memory_order_acquire)) {
+            return std::unexpected(RegisterError::Closed);
         }
 
-        head_.store(tail, std::memory_order_release);
+        std::size_t id = 0;
+        if (const auto reused = claim_free_slot()) {
+            if (auto* ring = ring_at(*reused)) {
+                ring->place(placement);
+                return Producer{.ring = ring, .id = *reused};
+            }
+            // Freed by a failed allocation, so it has no ring yet.
+            id = *reused;
+        } else {
+            id = producer_count_.fetch_add(1, std::memory_order_relaxed);
+            if (id >= slots_.size()) {
+                producer_count_.fetch_sub(1, std::memory_order_relaxed);
+                return std::unexpected(RegisterError::TooManyProducers);
+            }
+        }
 
-        if constexpr (config.enable_metrics) {
-            metrics_.messages_received += detail::narrow_cast<std::size_t>(tail - head);
-            metrics_.batches_received += 1;
+        // On failure the id goes back on the free list; the consumer skips
+        // empty slots.
+        auto* ring = make_ring();
+        if (ring == nullptr) {
+            free_[id / 64].fetch_or(ready_mask(id), std::memory_order_release);
+            return std::unexpected(RegisterError::OutOfMemory);
         }
 
-        return detail::narrow_cast<std::size_t>(tail - head);
-    }
+        ring->place(placement);
+        ring->set_readable_event(readable_event_);
+        ring->set_ready_bit(ready_[id / 64], ready_mask(id), groups_[id / 64 / 64], ready_mask(id / 64), poller_link_);
+        if constexpr (config.sequence_stamps) {
+            ring->set_sequence_source(sequence_.next);
+        }
+        ring->mark_active();
+        slots_[id].store(ring, std::memory_order_release);
 
-    template <void (*Callback)(const T*)>
-    std::size_t consume_batch_fn() noexcept(noexcept(Callback(static_cast<const T*>(nullptr)))) {
-        struct Handler {
-            static void process(const T* item) { Callback(item); }
-        };
-        return consume_batch(Handler{});
+        // close() may have walked the slots before this ring was published.
+        if (closed_.load(std::memory_order_acquire)) {
+            ring->close();
+        }
+        return Producer{.ring = ring, .id = id};
     }
 
-    // Convenience wrappers
-    std::size_t send(std::span<const T> items) noexcept {
-        const auto r = reserve(items.size());
-        if (!r) {
-            return 0;
+    [[nodiscard]] std::expected<ScopedProducer, RegisterError> register_scoped(
+        const Placement& placement = {}) noexcept {
+        auto p = register_producer(placement);
+        if (!p) {
+            return std::unexpected(p.error());
         }
-        std::ranges::copy(items.first(r->slice.size()), r->slice.begin());
-        commit(r->slice.size());
-        return r->slice.size();
+        return ScopedProducer{this, *p};
     }
 
-    std::size_t recv(std::span<T> out) noexcept {
-        auto slice = readable();
-        if (!slice) {
-            return 0;
+    // Producer API for code without a Producer at hand: the calling thread
+    // is registered (default placement) on its first call and keeps that
+    // ring until it exits, when it is deregistered. After the first call
+    // the lookup is one thread-local compare per call as long as the thread
+    // keeps to one channel; switching channels costs a scan of its
+    // registrations. Return as the Producer calls do, and fail like them if
+    // the thread cannot be registered.
+    [[nodiscard]] std::optional<LocalReservation> reserve_local(std::size_t n) noexcept {
+        auto* ring = local_ring();
+        if (ring == nullptr) {
+            return std::nullopt;
         }
-        const auto n = std::min(slice->size(), out.size());
-        std::ranges::copy(slice->first(n), out.begin());
-        advance(n);
-        return n;
+        if (auto r = ring->reserve(n)) {
+            return LocalReservation{*r, ring};
+        }
+        return std::nullopt;
     }
 
-    void close() noexcept { closed_.store(true, std::memory_order_release); }
+    // Commits n slots of a reserve_local() reservation on its ring.
+    void commit_local(const LocalReservation& reservation, std::size_t n) noexcept { reservation.ring->commit(n); }
 
-    [[nodiscard]] Metrics get_metrics() const noexcept {
-        if constexpr (config.enable_metrics) {
-            return metrics_;
-        }
-        return Metrics{};
+    std::size_t send_local(std::span<const T> items) noexcept(noexcept(std::declval<RingType&>().send(items))) {
+        auto* ring = local_ring();
+        return ring != nullptr ? ring->send(items) : 0;
     }
 
-    void mark_active() noexcept { active_.store(true, std::memory_order_release); }
-
-private:
-    static constexpr std::size_t CAPACITY = std::size_t{1} << config.ring_bits;
-    static constexpr std::size_t MASK = CAPACITY - 1;
+    template <typename... Args>
+    bool emplace_local(Args&&... args) noexcept(
+        noexcept(std::declval<RingType&>().emplace(std::forward<Args>(args)...))) {
+        auto* ring = local_ring();
+        return ring != nullptr && ring->emplace(std::forward<Args>(args)...);
+    }
 
-    [[nodiscard]] std::optional<Reservation<T>> make_reservation(std::uint64_t tail, std::size_t n) noexcept {
-        const auto idx = tail & MASK;
-        const auto contiguous = std::min<std::size_t>(n, CAPACITY - idx);
+    // The calling thread's Producer, registered as for the calls above. A
+    // loop that holds it skips their per-call lookup and pays exactly what
+    // a Producer does. The thread still owns the registration: do not
+    // deregister it, and do not use it from another thread.
+    [[nodiscard]] std::optional<Producer> local_producer() noexcept {
+        auto* ring = local_ring();
+        if (ring == nullptr) {
+            return std::nullopt;
+        }
+        return Producer{.ring = ring, .id = detail::local_cache.id};
+    }
 
-        const auto next_idx = (tail + n) & MASK;
-        detail::prefetch(buffer_.data() + next_idx, true);
+    // Gives the producer's slot back. Its committed items are published
+    // and still delivered; the consumer recycles the slot (and ring) for a
+    // later register_producer() once it finds the ring drained, clearing
+    // its ready bit at once so passes stop visiting it. The Producer must
+    // not be used afterwards.
+    void deregister_producer(const Producer& producer) noexcept { producer.ring->retire(); }
 
-        return Reservation<T>{
-            .slice = std::span<T>{buffer_.data() + idx, contiguous},
-            .pos = tail,
-        };
+    // Both visit only rings whose ready bit is set, in index order from a
+    // start and with a per-ring limit chosen by config.schedule.
+    std::size_t recv(std::span<T> out) noexcept(noexcept(std::declval<RingType&>().recv(out))) {
+        std::size_t total = 0;
+        for_each_ready(
+            [&](std::size_t i, RingType& ring) {
+                const auto n = ring.recv(out.subspan(total).first(std::min(out.size() - total, ring_quota(i))));
+                note_poll(i, ring, n);
+                total += n;
+                return total < out.size();
+            },
+            next_start());
+        return total;
     }
 
-    alignas(128) std::atomic<std::uint64_t> tail_{0};
-    std::uint64_t cached_head_{0};
+    template <typename Handler>
+    std::size_t consume_all(Handler&& handler) noexcept(
+        noexcept(std::declval<RingType&>().consume_batch(handler))) {
+        std::size_t total = 0;
+        for_each_ready(
+            [&](std::size_t i, RingType& ring) {
+                const auto n = ring.consume_batch(handler, ring_quota(i));
+                note_poll(i, ring, n);
+                total += n;
+                return true;
+            },
+            next_start());
+        return total;
+    }
 
-    alignas(128) std::atomic<std::uint64_t> head_{0};
-    std::uint64_t cached_tail_{0};
+    // Consumes across rings in nondecreasing std::invoke(key, item) order,
+    // by a binary heap over the ring heads: O(log P) per run, where a run is
+    // the items one ring contributes before another ring's head is
+    // smaller. Handlers get each run as one process(std::span<const T>)
+    // call if they accept it, else process(const T*) per item.
+    //
+    // Only rings with items when the call starts take part, and the call
+    // stops as soon as one of them runs dry, since its next item could
+    // sort before anything still queued. Output stays ordered across calls
+    // as long as each producer's keys are nondecreasing and an idle
+    // producer does not later publish a key below what was already
+    // consumed.
+    template <typename Key, typename Handler>
+    std::size_t consume_merged(Key&& key, Handler&& handler) {
+        using Run = std::span<const T>;
+        constexpr bool by_span = detail::span_handler<std::remove_reference_t<Handler>, Run>;
+
+        auto* heap = merge_heap_.data();
+        std::size_t size = 0;
+        for_each_ready([&](std::size_t i, RingType& ring) {
+            if (auto run = ring.readable()) {
+                heap[size++] = MergeHead{.next = run->data(), .end = run->data() + run->size(), .ring = i};
+            } else {
+                note_poll(i, ring, 0);
+            }
+            return true;
+        });
+
+        // Min-heap on key; ties go to the lower ring index.
+        const auto after = [&](const MergeHead& a, const MergeHead& b) {
+            const auto& ka = std::invoke(key, *a.next);
+            const auto& kb = std::invoke(key, *b.next);
+            return kb < ka || (!(ka < kb) && b.ring < a.ring);
+        };
+        std::make_heap(heap, heap + size, after);
 
-    alignas(128) std::atomic<bool> active_{false};
-    std::atomic<bool> closed_{false};
-    [[no_unique_address]] std::conditional_t<config.enable_metrics, Metrics, std::monostate> metrics_{};
+        std::size_t total = 0;
+        while (size != 0) {
+            std::pop_heap(heap, heap + size, after);
+            auto& head = heap[size - 1];
+            const T* run_end = head.end;
+            if (size > 1) {
+                // Equal keys stay in the run only if this ring wins the tie.
+                const auto& limit = std::invoke(key, *heap[0].next);
+                const bool wins_ties = head.ring < heap[0].ring;
+                run_end = head.next + 1;
+                while (run_end != head.end) {
+                    const auto& k = std::invoke(key, *run_end);
+                    if (wins_ties ? limit < k : !(k < limit)) {
+                        break;
+                    }
+                    ++run_end;
+                }
+            }
 
-    alignas(64) std::array<T, CAPACITY> buffer_;
-};
+            if constexpr (by_span) {
+                handler.process(Run{head.next, run_end});
+            } else {
+                for (const T* item = head.next; item != run_end; ++item) {
+                    handler.process(item);
+                }
+            }
+            const auto n = detail::narrow_cast<std::size_t>(run_end - head.next);
+            auto* ring = ring_at(head.ring);
+            ring->advance(n);
+            total += n;
+
+            if (run_end == head.end) {
+                // Past the wrap, or newly published; else the ring ran dry.
+                auto run = ring->readable();
+                if (!run) {
+                    break;
+                }
+                head.end = run->data() + run->size();
+                run_end = run->data();
+            }
+            head.next = run_end;
+            std::push_heap(heap, heap + size, after);
+        }
+        return total;
+    }
 
-// ---------------------------------------------------------------------------
-// Channel (MPSC)
-// ---------------------------------------------------------------------------
+    // Zero-copy view of every ring with items: one region per ring, in ring
+    // order, pointing into ring memory. The items stay in place until
+    // release_readable() advances each ring by its region's consumed count
+    // (clamped to its size); producers cannot overwrite them meanwhile.
+    // Single consumer only, and one lease at a time: nothing else may
+    // consume from the channel between the two calls.
+    [[nodiscard]] std::span<ReadableRegion> lease_readable() noexcept {
+        leased_ = 0;
+        for_each_ready([&](std::size_t i, RingType& ring) {
+            const auto runs = ring.readable_all();
+            if (runs[0].empty()) {
+                note_poll(i, ring, 0);
+            } else {
+                regions_[leased_++] = ReadableRegion{.producer_id = i, .first = runs[0], .second = runs[1]};
+            }
+            return true;
+        });
+        return std::span<ReadableRegion>{regions_.data(), leased_};
+    }
 
-template <typename T, Config config = default_config>
-class Channel {
-    static_assert(config.max_producers > 0, "max_producers must be positive");
+    // Returns the total advanced across rings.
+    std::size_t release_readable() noexcept {
+        std::size_t total = 0;
+        for (std::size_t k = 0; k < leased_; ++k) {
+            const auto& region = regions_[k];
+            const auto n = std::min(region.consumed, region.size());
+            if (n != 0) {
+                auto* ring = ring_at(region.producer_id);
+                ring->advance(n);
+                note_poll(region.producer_id, *ring, n);
+            }
+            total += n;
+        }
+        leased_ = 0;
+        return total;
+    }
 
-    using RingType = Ring<T, config>;
+    // Config::sequence_stamps: consumes in exact sequence order, a run at a
+    // time, using the merge heap keyed on each ring's head stamp. Stops at
+    // the first sequence not yet visible: its producer has taken the ticket
+    // but not published (deferred tails included), so a later call resumes
+    // there. It tracks the next sequence itself, so it must be the
+    // channel's only consumer. Handlers may take process(item, sequence).
+    template <typename Handler>
+    std::size_t consume_sequenced(Handler&& handler) requires(config.sequence_stamps) {
+        auto* heap = merge_heap_.data();
+        std::size_t size = 0;
+        for_each_ready([&](std::size_t i, RingType& ring) {
+            if (const auto seq = ring.head_sequence()) {
+                heap[size++] = MergeHead{.ring = i, .sequence = *seq};
+            } else {
+                note_poll(i, ring, 0);
+            }
+            return true;
+        });
 
-public:
-    struct Producer {
-        RingType* ring = nullptr;
-        std::size_t id = 0;
+        const auto after = [](const MergeHead& a, const MergeHead& b) { return b.sequence < a.sequence; };
+        std::make_heap(heap, heap + size, after);
 
-        [[nodiscard]] std::optional<Reservation<T>> reserve(std::size_t n) noexcept {
-            return ring->reserve(n);
-        }
-        [[nodiscard]] std::optional<Reservation<T>> reserve_with_backoff(std::size_t n) noexcept {
-            return ring->reserve_with_backoff(n);
+        std::size_t total = 0;
+        while (size != 0 && heap[0].sequence == next_sequence_) {
+            std::pop_heap(heap, heap + size, after);
+            auto& head = heap[size - 1];
+            auto* ring = ring_at(head.ring);
+            const auto n = ring->consume_batch(handler, ring->sequenced_run(next_sequence_));
+            next_sequence_ += n;
+            total += n;
+
+            if (const auto seq = ring->head_sequence()) {
+                head.sequence = *seq;
+                std::push_heap(heap, heap + size, after);
+            } else {
+                --size;
+            }
         }
-        void commit(std::size_t n) noexcept { ring->commit(n); }
-        std::size_t send(std::span<const T> items) noexcept { return ring->send(items); }
-    };
-
-    enum class RegisterError { TooManyProducers, Closed };
-    using RegisterResult = std::expected<Producer, RegisterError>;
+        return total;
+    }
 
-    constexpr Channel() = default;
+    // Next sequence consume_sequenced() will deliver.
+    [[nodiscard]] std::uint64_t next_sequence() const noexcept requires(config.sequence_stamps) {
+        return next_sequence_;
+    }
 
-    [[nodiscard]] RegisterResult register_producer() noexcept {
-        if (closed_.load(std::memory_order_acquire)) {
-            return std::unexpected(RegisterError::Closed);
+    // Schedule::Weighted: producer_id gets weight * config.schedule_quota
+    // items per call (weight 0 counts as 1, the default). A recycled slot
+    // starts over at the default.
+    void set_weight(std::size_t producer_id, std::uint32_t weight) noexcept {
+        if (producer_id < weights_.size()) {
+            weights_[producer_id].store(weight, std::memory_order_relaxed);
         }
+    }
 
-        const auto id = producer_count_.fetch_add(1, std::memory_order_relaxed);
-        if (id >= config.max_producers) {
-            producer_count_.fetch_sub(1, std::memory_order_relaxed);
-            return std::unexpected(RegisterError::TooManyProducers);
-        }
+    // Blocking variants of recv() and consume_all(). Every ring wakes the
+    // same channel-wide event, and only when the consumer announced that it
+    // sleeps. Return 0 on timeout or once closed and drained.
+    std::size_t recv_wait(std::span<T> out, std::chrono::nanoseconds timeout = wait_forever) noexcept(
+        noexcept(std::declval<BasicChannel&>().recv(out))) {
+        return detail::wait_for(readable_event_, timeout, [&] { return recv(out); }, [&] { return is_closed(); });
+    }
 
-        rings_[id].mark_active();
-        return Producer{.ring = &rings_[id], .id = id};
+    template <typename Handler>
+    std::size_t consume_all_wait(Handler&& handler, std::chrono::nanoseconds timeout = wait_forever) noexcept(
+        noexcept(std::declval<BasicChannel&>().consume_all(handler))) {
+        return detail::wait_for(readable_event_, timeout, [&] { return consume_all(handler); },
+                                [&] { return is_closed(); });
     }
 
-    std::size_t recv(std::span<T> out) noexcept {
-        std::size_t total = 0;
-        const auto count = producer_count_.load(std::memory_order_acquire);
-        for (std::size_t i = 0; i < count && total < out.size(); ++i) {
-            total += rings_[i].recv(out.subspan(total));
+    // Non-blocking eventfd for epoll-driven consumers, created on first call
+    // (consumer thread; -1 if unavailable). It becomes readable once a
+    // producer publishes into an empty channel, with a single write() per
+    // burst. After draining with consume_all()/recv(), call
+    // rearm_notification() before going back to epoll.
+    [[nodiscard]] int notification_fd() noexcept {
+#if defined(__linux__)
+        if (notification_fd_ < 0) {
+            notification_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (notification_fd_ >= 0) {
+                readable_event_.attach_fd(notification_fd_);
+                rearm_notification();
+            }
         }
-        return total;
+#endif
+        return notification_fd_;
     }
 
-    template <typename Handler>
-    std::size_t consume_all(Handler&& handler) noexcept(noexcept(handler.process(static_cast<const T*>(nullptr)))) {
-        std::size_t total = 0;
-        const auto count = producer_count_.load(std::memory_order_acquire);
+    // Clears the fd and arms it for the next publication. If items (or a
+    // close) slipped in meanwhile, the fd is signalled again at once, so the
+    // consumer never sleeps on pending data.
+    void rearm_notification() noexcept {
+        if (notification_fd_ < 0) {
+            return;
+        }
+        readable_event_.clear_fd();
+        readable_event_.arm_fd();
+        if ((has_pending() || is_closed()) && readable_event_.disarm_fd()) {
+            readable_event_.signal_fd();
+        }
+    }
+
+    // True if any ring holds published items.
+    [[nodiscard]] bool has_pending() const noexcept {
+        const auto count = producer_count();
         for (std::size_t i = 0; i < count; ++i) {
-            total += rings_[i].consume_batch(handler);
+            if (const auto* ring = ring_at(i); ring != nullptr && !ring->is_empty()) {
+                return true;
+            }
         }
-        return total;
+        return false;
     }
 
     void close() noexcept {
         closed_.store(true, std::memory_order_release);
-        const auto count = producer_count_.load(std::memory_order_acquire);
+        const auto count = producer_count();
         for (std::size_t i = 0; i < count; ++i) {
-            rings_[i].close();
+            if (auto* ring = ring_at(i)) {
+                ring->close();
+            }
         }
+        readable_event_.notify();
     }
 
     [[nodiscard]] bool is_closed() const noexcept { return closed_.load(std::memory_order_acquire); }
-    [[nodiscard]] std::size_t producer_count() const noexcept { return producer_count_.load(std::memory_order_acquire); }
+
+    [[nodiscard]] std::size_t producer_count() const noexcept {
+        return std::min(producer_count_.load(std::memory_order_acquire), slots_.size());
+    }
 
     [[nodiscard]] Metrics get_metrics() const noexcept {
         Metrics m{};
-        const auto count = producer_count_.load(std::memory_order_acquire);
+        const auto count = producer_count();
         for (std::size_t i = 0; i < count; ++i) {
-            const auto rm = rings_[i].get_metrics();
+            const auto* ring = ring_at(i);
+            if (ring == nullptr) {
+                continue;
+            }
+            const auto rm = ring->get_metrics();
             m.messages_sent += rm.messages_sent;
             m.messages_received += rm.messages_received;
             m.batches_sent += rm.batches_sent;
             m.batches_received += rm.batches_received;
+            m.overruns += rm.overruns;
+            m.drops += rm.drops;
         }
         return m;
     }
 
 private:
-    alignas(128) std::array<RingType, config.max_producers> rings_{};
+    friend class Poller;
+
+    struct MergeHead {
+        const T* next = nullptr;
+        const T* end = nullptr;
+        std::size_t ring = 0;
+        std::uint64_t sequence = 0;  // consume_sequenced() only
+    };
+
+    // Empty polls after which a ring's ready bit is cleared. Clearing costs
+    // a heavy_barrier(), so busy rings that drain now and then keep theirs.
+    static constexpr std::uint32_t idle_polls_before_clear = 32;
+
+    [[nodiscard]] RingType* ring_at(std::size_t i) const noexcept {
+        return slots_[i].load(std::memory_order_acquire);
+    }
+
+    // Some ring's ready bit may be set.
+    [[nodiscard]] bool any_ready() const noexcept {
+        for (std::size_t g = 0; g < groups_.size(); ++g) {
+            if (groups_[g].load(std::memory_order_acquire) != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static constexpr std::uint64_t ready_mask(std::size_t i) noexcept { return std::uint64_t{1} << (i % 64); }
+
+    // fn(index, ring) for every ring with its ready bit set, from ring
+    // start round to start - 1, until it returns false. A set bit implies a
+    // published ring. Only words whose group bit is set are loaded.
+    template <typename Fn>
+    void for_each_ready(Fn&& fn, std::size_t start = 0) {
+        const auto words = ready_.size();
+        const auto first = start / 64;
+        const auto below_start = ready_mask(start) - 1;
+        const auto visit = [&](std::size_t w, std::uint64_t keep) {
+            for (auto bits = ready_[w].load(std::memory_order_acquire) & keep; bits != 0; bits &= bits - 1) {
+                const auto i = w * 64 + static_cast<std::size_t>(std::countr_zero(bits));
+                if (!fn(i, *ring_at(i))) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        const auto all = [&](std::size_t w) { return visit(w, ~std::uint64_t{0}); };
+
+        // The start word is visited twice when start is mid-word: bits from
+        // start up first, the ones below it last.
+        if (!for_each_group(first, first + 1, [&](std::size_t w) { return visit(w, ~below_start); }) ||
+            !for_each_group(first + 1, words, all) || !for_each_group(0, first, all)) {
+            return;
+        }
+        if (below_start != 0) {
+            for_each_group(first, first + 1, [&](std::size_t w) { return visit(w, below_start); });
+        }
+    }
+
+    // fn(w) for every ready word w in [lo, hi) whose group bit is set, until
+    // it returns false (then so does this).
+    template <typename Fn>
+    bool for_each_group(std::size_t lo, std::size_t hi, Fn&& fn) {
+        for (auto g = lo / 64; g * 64 < hi; ++g) {
+            const auto base = g * 64;
+            auto bits = groups_[g].load(std::memory_order_acquire);
+            if (lo > base) {
+                bits &= ~(ready_mask(lo) - 1);
+            }
+            if (hi < base + 64) {
+                bits &= ready_mask(hi) - 1;
+            }
+            for (; bits != 0; bits &= bits - 1) {
+                if (!fn(base + static_cast<std::size_t>(std::countr_zero(bits)))) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Ring the next recv()/consume_all() starts from.
+    [[nodiscard]] std::size_t next_start() noexcept {
+        if constexpr (config.schedule == Schedule::InOrder) {
+            return 0;
+        } else {
+            const auto count = producer_count();
+            const auto start = start_ < count ? start_ : 0;
+            start_ = start + 1 < count ? start + 1 : 0;
+            return start;
+        }
+    }
+
+    [[nodiscard]] std::size_t ring_quota(std::size_t i) const noexcept {
+        if constexpr (config.schedule == Schedule::Quota) {
+            return config.schedule_quota;
+        } else if constexpr (config.schedule == Schedule::Weighted) {
+            return config.schedule_quota * std::max<std::uint32_t>(weights_[i].load(std::memory_order_relaxed), 1);
+        } else {
+            return SIZE_MAX;
+        }
+    }
+
+    // Run by whoever consumed ring i (n items). After enough empty polls
+    // the bit is cleared, then the ring re-checked: the barrier pairs with
+    // the producer's light_barrier() between its tail store and its bit
+    // check, so one side always sees the other. The group bit follows the
+    // same protocol one level up: cleared with the word's last bit, and
+    // raised again by whoever then leaves the word non-zero.
+    void note_poll(std::size_t i, RingType& ring, std::size_t n) noexcept {
+        auto& idle = ring.idle_polls();
+        if (n != 0) {
+            idle = 0;
+            return;
+        }
+        // A retired ring is cleared on its first empty poll, then recycled.
+        if (++idle < idle_polls_before_clear && !ring.is_retired()) {
+            return;
+        }
+        idle = 0;
+        const auto w = i / 64;
+        auto& word = ready_[w];
+        auto& group = groups_[w / 64];
+        if ((word.fetch_and(~ready_mask(i), std::memory_order_relaxed) & ~ready_mask(i)) == 0) {
+            group.fetch_and(~ready_mask(w), std::memory_order_relaxed);
+        }
+        detail::heavy_barrier();
+        // retire() publishes before it sets the flag, so a retired ring
+        // seen empty stays empty.
+        const bool drained = ring.is_retired() && ring.is_empty();
+        if (!drained && !ring.is_empty()) {
+            word.fetch_or(ready_mask(i), std::memory_order_relaxed);
+        }
+        detail::light_barrier();
+        if (word.load(std::memory_order_relaxed) != 0 && (group.load(std::memory_order_relaxed) & ready_mask(w)) == 0) {
+            group.fetch_or(ready_mask(w), std::memory_order_relaxed);
+        }
+        if (drained) {
+            ring.revive();
+            weights_[i].store(0, std::memory_order_relaxed);
+            free_[w].fetch_or(ready_mask(i), std::memory_order_release);
+        }
+    }
+
+    [[nodiscard]] RingType* local_ring() noexcept {
+        if (detail::local_cache.channel == local_id_) [[likely]] {
+            return static_cast<RingType*>(detail::local_cache.ring);
+        }
+        return register_local();
+    }
+
+    [[nodiscard]] RingType* register_local() noexcept {
+        auto& entries = detail::local_producers.entries;
+        auto it = std::ranges::find(entries, local_id_, &detail::LocalProducer::channel);
+        if (it == entries.end()) {
+            auto p = register_producer();
+            if (!p) {
+                return nullptr;
+            }
+            try {
+                auto& registry = detail::LocalRegistry::instance();
+                const std::lock_guard lock(registry.mutex);
+                // Forget registrations on channels destroyed since.
+                std::erase_if(entries, [&](const detail::LocalProducer& e) {
+                    return std::ranges::find(registry.live, e.channel) == registry.live.end();
+                });
+                entries.push_back({.channel = local_id_,
+                                   .ring = p->ring,
+                                   .id = p->id,
+                                   .retire = [](void* ring) noexcept { static_cast<RingType*>(ring)->retire(); }});
+                if (!has_local_producers_) {
+                    registry.live.push_back(local_id_);
+                    has_local_producers_ = true;
+                }
+            } catch (...) {
+                if (!entries.empty() && entries.back().channel == local_id_) {
+                    entries.pop_back();
+                }
+                deregister_producer(*p);
+                return nullptr;
+            }
+            it = entries.end() - 1;
+        }
+        detail::local_cache = {.channel = local_id_, .ring = it->ring, .id = it->id};
+        return static_cast<RingType*>(it->ring);
+    }
+
+    // Takes the lowest recycled slot, if any.
+    [[nodiscard]] std::optional<std::size_t> claim_free_slot() noexcept {
+        for (std::size_t w = 0; w < free_.size(); ++w) {
+            for (auto bits = free_[w].load(std::memory_order_relaxed); bits != 0;
+                 bits = free_[w].load(std::memory_order_relaxed)) {
+                const auto mask = bits & -bits;
+                if ((free_[w].fetch_and(~mask, std::memory_order_acquire) & mask) != 0) {
+                    return w * 64 + static_cast<std::size_t>(std::countr_zero(mask));
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
+    [[nodiscard]] RingType* make_ring() noexcept {
+        try {
+            if constexpr (std::is_constructible_v<RingType, std::size_t>) {
+                return detail::create<RingType, RingType::object_memory>(ring_capacity_);
+            } else {
+                return detail::create<RingType, RingType::object_memory>();
+            }
+        } catch (...) {
+            return nullptr;
+        }
+    }
+
+    alignas(128) Slots slots_{};
+    // Bit i: ring i may hold published items. Bit w of groups_: ready_[w]
+    // may be non-zero, so an idle pass loads one word per 4096 rings.
+    alignas(128) detail::ready_bitmap_t<Slots> ready_{};
+    detail::ready_bitmap_t<Slots, 1> groups_{};
+    // Bit i: slot i was deregistered and drained, so its ring is free.
+    alignas(128) detail::ready_bitmap_t<Slots> free_{};
+    // Consumer side, off the line producers write the ready bits on.
+    alignas(128) detail::slot_array_t<Slots, std::atomic<std::uint32_t>> weights_{};
+    std::size_t start_ = 0;
+    detail::slot_array_t<Slots, MergeHead> merge_heap_{};
+    detail::slot_array_t<Slots, ReadableRegion> regions_{};
+    std::size_t leased_ = 0;
+    std::uint64_t next_sequence_ = 0;
+    std::size_t ring_capacity_ = std::size_t{1} << config.ring_bits;
     std::atomic<std::size_t> producer_count_{0};
     std::atomic<bool> closed_{false};
+
+    alignas(128) detail::EventCount readable_event_;
+    int notification_fd_ = -1;
+    std::atomic<std::size_t> next_home_{0};
+
+    detail::ChannelLink poller_link_;
+
+    const std::uint64_t local_id_ = detail::next_channel_id.fetch_add(1, std::memory_order_relaxed);
+    bool has_local_producers_ = false;  // Guarded by LocalRegistry::mutex
+
+    [[no_unique_address]] std::conditional_t<config.sequence_stamps, detail::SequenceCounter, std::monostate> sequence_{};
+};
+
+template <typename T, Config config = default_config>
+class Channel
+    : public BasicChannel<Ring<T, config>, config, std::array<std::atomic<Ring<T, config>*>, config.max_producers>> {
+    static_assert(config.max_producers > 0, "max_producers must be positive");
+
+public:
+    constexpr Channel() = default;
+};
+
+// Channel whose ring capacity and producer limit are chosen at construction.
+// Each ring buffer is a separate cache-line aligned allocation.
+template <typename T, Config config = default_config>
+class DynamicChannel
+    : public BasicChannel<DynamicRing<T, config>, config, detail::HeapArray<std::atomic<DynamicRing<T, config>*>>> {
+    using Base = BasicChannel<DynamicRing<T, config>, config, detail::HeapArray<std::atomic<DynamicRing<T, config>*>>>;
+
+public:
+    explicit DynamicChannel(std::size_t ring_capacity = std::size_t{1} << config.ring_bits,
+                            std::size_t max_producers = config.max_producers)
+        : Base(std::max<std::size_t>(max_producers, 1), ring_capacity) {}
+};
+
+// MPSC channel of variable-length records, one ByteRing per producer.
+// consume_all() hands each record to handler.process(std::span<const std::byte>).
+template <Config config = default_config>
+class ByteChannel
+    : public BasicChannel<ByteRing<config>, config, std::array<std::atomic<ByteRing<config>*>, config.max_producers>> {
+    static_assert(config.max_producers > 0, "max_producers must be positive");
+
+public:
+    constexpr ByteChannel() = default;
+};
+
+// Lossy MPSC channel, one OverwriteRing per producer: producers never wait,
+// and get_metrics().overruns counts what the consumer missed.
+template <typename T, Config config = default_config>
+class OverwriteChannel : public BasicChannel<OverwriteRing<T, config>, config,
+                                             std::array<std::atomic<OverwriteRing<T, config>*>, config.max_producers>> {
+    static_assert(config.max_producers > 0, "max_producers must be positive");
+
+public:
+    constexpr OverwriteChannel() = default;
+};
+
+// ---------------------------------------------------------------------------
+// Poller
+// ---------------------------------------------------------------------------
+
+// Services up to 64 channels, of any element type, from one consumer
+// thread. Each channel is added with its handler. poll() drains only the
+// channels whose bit is set in the Poller's readiness word, which a
+// channel's producers raise together with its group bits. poll_wait()
+// parks on the Poller's one EventCount once every channel is idle, after
+// arming each channel's own event to forward its next notify() there.
+//
+// A channel belongs to at most one Poller and, once added, is consumed
+// only through it for the Poller's lifetime. Destroy the Poller only after
+// the channels' producers have stopped.
+class Poller {
+public:
+    static constexpr std::size_t max_channels = 64;
+
+    Poller() = default;
+    Poller(const Poller&) = delete;
+    Poller& operator=(const Poller&) = delete;
+
+    ~Poller() {
+        for (auto& s : sources_) {
+            s.detach(s.channel);
+        }
+    }
+
+    // Returns false if the Poller is full or the channel already has one.
+    // handler is kept (it may be move-only) and passed to consume_all().
+    template <typename Ch, typename Handler>
+    bool add(Ch& channel, Handler handler) {
+        if (sources_.size() == max_channels || channel.poller_link_.word.load(std::memory_order_relaxed) != nullptr) {
+            return false;
+        }
+        const auto bit = std::uint64_t{1} << sources_.size();
+        sources_.push_back(Source{
+            .channel = &channel,
+            .drain = [&channel, h = std::move(handler)]() mutable { return channel.consume_all(h); },
+            .ready = [](void* c) noexcept { return static_cast<Ch*>(c)->any_ready(); },
+            .pending = [](void* c) noexcept { return static_cast<Ch*>(c)->has_pending(); },
+            .closed = [](void* c) noexcept { return static_cast<Ch*>(c)->is_closed(); },
+            .arm = [](void* c) noexcept { static_cast<Ch*>(c)->readable_event_.arm_parent(); },
+            .detach =
+                [](void* c) noexcept {
+                    auto* ch = static_cast<Ch*>(c);
+                    ch->poller_link_.word.store(nullptr, std::memory_order_release);
+                    ch->readable_event_.disarm_parent();
+                },
+        });
+        channel.readable_event_.attach_parent(&event_);
+        channel.poller_link_.mask = bit;
+        channel.poller_link_.word.store(&ready_, std::memory_order_release);
+        // Group bits raised before the link was visible did not raise ours.
+        ready_.fetch_or(bit, std::memory_order_relaxed);
+        return true;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return sources_.size(); }
+
+    // One consume_all() per channel with its bit set. A channel that yields
+    // nothing and whose rings have all idled out loses its bit, then is
+    // re-checked, as BasicChannel::note_poll() does one level down.
+    std::size_t poll() {
+        std::size_t total = 0;
+        for (auto bits = ready_.load(std::memory_order_acquire); bits != 0; bits &= bits - 1) {
+            const auto mask = bits & -bits;
+            auto& s = sources_[static_cast<std::size_t>(std::countr_zero(bits))];
+            const auto n = s.drain();
+            total += n;
+            if (n == 0 && !s.ready(s.channel)) {
+                ready_.fetch_and(~mask, std::memory_order_relaxed);
+                detail::heavy_barrier();
+                if (s.ready(s.channel)) {
+                    ready_.fetch_or(mask, std::memory_order_relaxed);
+                }
+            }
+        }
+        return total;
+    }
+
+    // poll(), spinning and then sleeping until some channel has items, the
+    // timeout expires, or every channel is closed and drained. Returns 0 in
+    // the last two cases.
+    std::size_t poll_wait(std::chrono::nanoseconds timeout = wait_forever) {
+        const detail::Deadline deadline(timeout);
+        Backoff backoff;
+        while (true) {
+            if (const auto n = poll()) {
+                return n;
+            }
+            if (deadline.expired() || all_done()) {
+                return poll();
+            }
+            if (!backoff.is_completed()) {
+                backoff.snooze();
+                continue;
+            }
+
+            // The re-check reads the rings themselves: a producer raises
+            // the readiness bits only after its notify.
+            for (auto& s : sources_) {
+                s.arm(s.channel);
+            }
+            const auto key = event_.prepare_wait();
+            if (std::ranges::any_of(sources_, [](const Source& s) { return s.pending(s.channel); })) {
+                event_.cancel_wait();
+                continue;
+            }
+            if (all_done()) {
+                event_.cancel_wait();
+                return 0;
+            }
+            event_.wait(key, deadline);
+        }
+    }
+
+private:
+    // Type-erased channel: its handler lives in drain.
+    struct Source {
+        void* channel;
+        std::move_only_function<std::size_t()> drain;
+        bool (*ready)(void*) noexcept;
+        bool (*pending)(void*) noexcept;
+        bool (*closed)(void*) noexcept;
+        void (*arm)(void*) noexcept;
+        void (*detach)(void*) noexcept;
+    };
+
+    [[nodiscard]] bool all_done() const noexcept {
+        return std::ranges::all_of(sources_,
+                                   [](const Source& s) { return s.closed(s.channel) && !s.pending(s.channel); });
+    }
+
+    std::vector<Source> sources_;
+    // Bit k: sources_[k] may have items. Raised by producers.
+    alignas(128) std::atomic<std::uint64_t> ready_{0};
+    alignas(128) detail::EventCount event_;
 };
 
 // Convenience aliases
 using DefaultRing = Ring<std::uint64_t, default_config>;
 using DefaultChannel = Channel<std::uint64_t, default_config>;
+using DefaultDynamicRing = DynamicRing<std::uint64_t, default_config>;
+using DefaultDynamicChannel = DynamicChannel<std::uint64_t, default_config>;
 
 } // namespace ringmpsc
@@ -0,0 +1,125 @@
+// Fan-out to several consumers: one Ring per consumer with every message
+// copied into each, versus a BroadcastRing writing each message once.
+// Usage: bench_broadcast [msgs] [consumers] (defaults: 10_000_000, 3).
+
+#include <ringmpsc.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace ringmpsc;
+
+namespace {
+
+constexpr Config cfg{.ring_bits = 14, .max_producers = 1, .max_consumers = 16};
+constexpr std::size_t batch = 64;
+
+struct Sum {
+    std::uint64_t sum = 0;
+    std::uint64_t count = 0;
+    void process(std::span<const std::uint64_t> run) {
+        for (auto v : run) {
+            sum += v;
+        }
+        count += run.size();
+    }
+};
+
+double run_copies(std::uint64_t msgs, std::size_t consumers) {
+    std::vector<std::unique_ptr<Ring<std::uint64_t, cfg>>> rings;
+    for (std::size_t i = 0; i < consumers; ++i) {
+        rings.push_back(std::make_unique<Ring<std::uint64_t, cfg>>());
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (auto& ring : rings) {
+        threads.emplace_back([&ring, msgs] {
+            Sum handler;
+            while (handler.count < msgs) {
+                if (ring->consume_batch(handler) == 0) {
+                    detail::cpu_relax();
+                }
+            }
+        });
+    }
+
+    std::uint64_t values[batch];
+    for (std::uint64_t sent = 0; sent < msgs; sent += batch) {
+        for (std::size_t j = 0; j < batch; ++j) {
+            values[j] = sent + j;
+        }
+        const auto n = std::min<std::uint64_t>(batch, msgs - sent);
+        for (auto& ring : rings) {
+            for (std::uint64_t done = 0; done < n;) {
+                done += ring->send(std::span<const std::uint64_t>{values + done, values + n});
+            }
+        }
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+double run_broadcast(std::uint64_t msgs, std::size_t consumers) {
+    auto ring = std::make_unique<BroadcastRing<std::uint64_t, cfg>>();
+    std::vector<BroadcastRing<std::uint64_t, cfg>::Consumer> readers;
+    for (std::size_t i = 0; i < consumers; ++i) {
+        readers.push_back(*ring->register_consumer());
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (auto& reader : readers) {
+        threads.emplace_back([&reader, msgs] {
+            Sum handler;
+            while (handler.count < msgs) {
+                if (reader.consume_batch(handler) == 0) {
+                    detail::cpu_relax();
+                }
+            }
+        });
+    }
+
+    std::uint64_t values[batch];
+    for (std::uint64_t sent = 0; sent < msgs; sent += batch) {
+        for (std::size_t j = 0; j < batch; ++j) {
+            values[j] = sent + j;
+        }
+        const auto n = std::min<std::uint64_t>(batch, msgs - sent);
+        for (std::uint64_t done = 0; done < n;) {
+            done += ring->send(std::span<const std::uint64_t>{values + done, values + n});
+        }
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void print_row(std::string_view mode, std::uint64_t msgs, double secs) {
+    std::cout << mode << "\t" << secs * 1e3 << " ms\t" << static_cast<double>(msgs) / secs / 1e6 << " M msg/s\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::uint64_t msgs = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+    const std::size_t consumers = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 3;
+    if (consumers == 0 || consumers > cfg.max_consumers) {
+        std::cerr << "consumers must be between 1 and " << cfg.max_consumers << "\n";
+        return 1;
+    }
+
+    std::cout << msgs << " msgs to " << consumers << " consumers\n";
+    print_row("ring per consumer", msgs, run_copies(msgs, consumers));
+    print_row("broadcast", msgs, run_broadcast(msgs, consumers));
+    return 0;
+}
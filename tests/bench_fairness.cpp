@@ -0,0 +1,118 @@
+// Skewed load: producer 0 sends flat out while producers 1-3 send one
+// timestamped message every 20 us. Reports per-producer p99
+// enqueue-to-dequeue latency for each Channel schedule.
+// Usage: bench_fairness [millis_per_policy] (default: 500).
+
+#include <ringmpsc.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace ringmpsc;
+
+namespace {
+
+constexpr std::size_t producers = 4;
+
+struct Stamped {
+    std::int64_t enqueued_ns;
+    std::uint32_t producer;
+};
+
+std::int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+template <Config cfg>
+void run(std::string_view name, std::chrono::milliseconds duration) {
+    auto ch = std::make_unique<Channel<Stamped, cfg>>();
+    std::vector<typename Channel<Stamped, cfg>::Producer> regs;
+    for (std::size_t i = 0; i < producers; ++i) {
+        regs.push_back(*ch->register_producer());
+    }
+    if constexpr (cfg.schedule == Schedule::Weighted) {
+        // Favour the light producers so their messages never queue behind a
+        // full quota of the hot one.
+        for (std::size_t i = 1; i < producers; ++i) {
+            ch->set_weight(i, 4);
+        }
+    }
+
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> threads;
+    threads.emplace_back([&, p = regs[0]]() mutable {
+        while (!stop.load(std::memory_order_relaxed)) {
+            if (auto r = p.reserve(64)) {
+                const auto ts = now_ns();
+                for (auto& item : r->slice) {
+                    item = Stamped{.enqueued_ns = ts, .producer = 0};
+                }
+                p.commit(r->slice.size());
+            }
+        }
+    });
+    for (std::size_t i = 1; i < producers; ++i) {
+        threads.emplace_back([&, p = regs[i], i]() mutable {
+            auto next = std::chrono::steady_clock::now();
+            while (!stop.load(std::memory_order_relaxed)) {
+                next += std::chrono::microseconds(20);
+                while (std::chrono::steady_clock::now() < next) {
+                    detail::cpu_relax();
+                }
+                p.emplace(Stamped{.enqueued_ns = now_ns(), .producer = static_cast<std::uint32_t>(i)});
+            }
+        });
+    }
+
+    std::vector<std::vector<std::int64_t>> latency(producers);
+    struct Handler {
+        std::vector<std::vector<std::int64_t>>* latency;
+        void process(const Stamped* s) { (*latency)[s->producer].push_back(now_ns() - s->enqueued_ns); }
+    };
+    const auto end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end) {
+        if (ch->consume_all(Handler{.latency = &latency}) == 0) {
+            detail::cpu_relax();
+        }
+    }
+    stop.store(true);
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    std::cout << name;
+    for (auto& samples : latency) {
+        if (samples.empty()) {
+            std::cout << "\t-";
+            continue;
+        }
+        std::ranges::sort(samples);
+        std::cout << "\t" << static_cast<double>(samples[samples.size() * 99 / 100]) / 1e3;
+    }
+    std::cout << "\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::chrono::milliseconds duration{argc > 1 ? std::strtoll(argv[1], nullptr, 10) : 500};
+
+    std::cout << "p99 enqueue-to-dequeue latency (us); producer 0 is hot\n";
+    std::cout << "schedule\tp0\tp1\tp2\tp3\n";
+    run<Config{.ring_bits = 14, .max_producers = producers}>("in-order", duration);
+    run<Config{.ring_bits = 14, .max_producers = producers, .schedule = Schedule::Rotate}>("rotate", duration);
+    run<Config{.ring_bits = 14, .max_producers = producers, .schedule = Schedule::Quota, .schedule_quota = 64}>(
+        "quota", duration);
+    run<Config{.ring_bits = 14, .max_producers = producers, .schedule = Schedule::Weighted, .schedule_quota = 64}>(
+        "weighted", duration);
+    return 0;
+}
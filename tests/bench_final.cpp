@@ -1,5 +1,8 @@
 // C++23 benchmark mirroring src/bench_final.zig (scaled for quick runs).
 // Adjustable message count via argv[1] or env BENCH_MSG (default: 1_000_000).
+// Each row runs the compile-time Channel and the runtime-sized DynamicChannel.
+// BENCH_MODE=hugepages instead compares MemoryPolicy::Heap and ::HugePages on
+// 2^18-slot rings, with dTLB load misses where perf events are available.
 
 #include <ringmpsc.hpp>
 
@@ -8,9 +11,19 @@
 #include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <optional>
+#include <span>
+#include <string_view>
 #include <thread>
 #include <vector>
 
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 using namespace ringmpsc;
 
 namespace {
@@ -22,19 +35,70 @@ std::uint64_t get_env_u64(const char* name, std::uint64_t def) {
     return def;
 }
 
+// Counts dTLB load misses of this thread and every thread it spawns.
+class TlbCounter {
+public:
+    TlbCounter() {
+#if defined(__linux__)
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled = 1;
+        attr.inherit = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd_ = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        if (fd_ >= 0) {
+            ::ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+            ::ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    ~TlbCounter() {
+#if defined(__linux__)
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+#endif
+    }
+
+    TlbCounter(const TlbCounter&) = delete;
+    TlbCounter& operator=(const TlbCounter&) = delete;
+
+    // Call after every spawned thread has been joined.
+    std::optional<std::uint64_t> read() {
+#if defined(__linux__)
+        std::uint64_t value = 0;
+        if (fd_ >= 0) {
+            ::ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+            if (::read(fd_, &value, sizeof(value)) == static_cast<ssize_t>(sizeof(value))) {
+                return value;
+            }
+        }
+#endif
+        return std::nullopt;
+    }
+
+private:
+    int fd_ = -1;
+};
+
 struct Result {
     double rate_billion_per_s = 0.0;
 };
 
-Result run_bench(std::size_t num_producers, std::uint64_t msgs_per_producer, std::uint64_t batch_override = 0) {
+constexpr std::size_t RING_BITS = 16;
+constexpr std::size_t MAX_PRODUCERS = 8;
+constexpr Config cfg{.ring_bits = RING_BITS, .max_producers = MAX_PRODUCERS};
+
+template <typename ChannelT>
+Result run_bench(ChannelT& channel, std::size_t num_producers, std::uint64_t msgs_per_producer,
+                 std::uint64_t batch_override = 0) {
     const std::size_t BATCH = batch_override != 0 ? static_cast<std::size_t>(batch_override)
                                                   : static_cast<std::size_t>(get_env_u64("BENCH_BATCH", 8192));
-    constexpr std::size_t RING_BITS = 16;
-    constexpr std::size_t MAX_PRODUCERS = 8;
-    constexpr Config cfg{.ring_bits = RING_BITS, .max_producers = MAX_PRODUCERS};
-
-    using ChannelT = Channel<std::uint32_t, cfg>;
-    ChannelT channel;
 
     std::vector<std::thread> producers;
     std::vector<std::thread> consumers;
@@ -44,7 +108,7 @@ Result run_bench(std::size_t num_producers, std::uint64_t msgs_per_producer, std
     std::vector<std::uint64_t> consumed(num_producers, 0);
 
     // Register producers upfront
-    std::vector<ChannelT::Producer> regs;
+    std::vector<typename ChannelT::Producer> regs;
     regs.reserve(num_producers);
     for (std::size_t i = 0; i < num_producers; ++i) {
         auto p = channel.register_producer();
@@ -54,20 +118,20 @@ Result run_bench(std::size_t num_producers, std::uint64_t msgs_per_producer, std
         regs.push_back(*p);
     }
 
-    // Consumer threads (one per ring, consume directly from that ring to avoid contention)
+    // Consumer threads, as many as rings, leasing rings through the channel
     for (std::size_t i = 0; i < num_producers; ++i) {
-        auto ring = regs[i].ring;
-        consumers.emplace_back([ring, i, &consumed] {
+        consumers.emplace_back([&channel, i, &consumed] {
             struct Handler {
                 std::uint64_t* counter;
                 inline void process(const std::uint32_t*) { ++(*counter); }
             } handler{.counter = &consumed[i]};
 
+            auto consumer = channel.make_consumer();
             Backoff backoff;
             while (true) {
-                auto n = ring->consume_batch(handler);
+                auto n = consumer.consume(handler);
                 if (n == 0) {
-                    if (ring->is_closed() && ring->is_empty()) break;
+                    if (channel.is_closed() && !channel.has_pending()) break;
                     backoff.snooze();
                 } else {
                     backoff.reset();
@@ -115,6 +179,35 @@ Result run_bench(std::size_t num_producers, std::uint64_t msgs_per_producer, std
     return {.rate_billion_per_s = rate * 1e9 / 1e9}; // scale to billions/sec
 }
 
+template <MemoryPolicy policy>
+void print_policy_row(std::size_t producers, std::uint64_t msgs_per_producer, std::uint64_t batch_override) {
+    constexpr Config tlb_cfg{.ring_bits = 18, .max_producers = MAX_PRODUCERS, .memory = policy};
+    DynamicChannel<std::uint32_t, tlb_cfg> channel;
+    TlbCounter tlb;
+    const auto r = run_bench(channel, producers, msgs_per_producer, batch_override);
+    const auto misses = tlb.read();
+    std::cout << " | " << r.rate_billion_per_s << " | ";
+    if (misses) {
+        std::cout << *misses;
+    } else {
+        std::cout << "n/a";
+    }
+}
+
+int run_hugepage_mode(std::span<const std::size_t> producer_counts, std::uint64_t msgs_per_producer,
+                      std::uint64_t batch_override) {
+    std::cout << "Hugepage mode: ring_bits=18 msgs/producer=" << msgs_per_producer << "\n";
+    std::cout << "Producers | Heap (B msg/s) | Heap dTLB misses | HugePages (B msg/s) | HugePages dTLB misses\n";
+    std::cout << "------------------------------------------------------------------------------------------\n";
+    for (auto p : producer_counts) {
+        std::cout << p << "        ";
+        print_policy_row<MemoryPolicy::Heap>(p, msgs_per_producer, batch_override);
+        print_policy_row<MemoryPolicy::HugePages>(p, msgs_per_producer, batch_override);
+        std::cout << "\n";
+    }
+    return 0;
+}
+
 } // namespace
 
 int main(int argc, char** argv) {
@@ -132,15 +225,22 @@ int main(int argc, char** argv) {
 
     const std::size_t producer_counts[] = {1, 2, 4, 6, 8};
 
+    if (const char* mode = std::getenv("BENCH_MODE"); mode != nullptr && std::string_view{mode} == "hugepages") {
+        return run_hugepage_mode(producer_counts, msgs_per_producer, batch_override);
+    }
+
     std::cout << "C++ bench (scaled): msgs/producer=" << msgs_per_producer << "\n";
     if (batch_override != 0) {
         std::cout << "Batch size override=" << batch_override << "\n";
     }
-    std::cout << "Producers | Throughput (B msg/s)\n";
-    std::cout << "-------------------------------\n";
+    std::cout << "Producers | Ring (B msg/s) | DynamicRing (B msg/s)\n";
+    std::cout << "-----------------------------------------------\n";
     for (auto p : producer_counts) {
-        auto r = run_bench(p, msgs_per_producer, batch_override);
-        std::cout << p << "         | " << r.rate_billion_per_s << "\n";
+        Channel<std::uint32_t, cfg> fixed;
+        const auto r = run_bench(fixed, p, msgs_per_producer, batch_override);
+        DynamicChannel<std::uint32_t, cfg> dynamic(std::size_t{1} << RING_BITS, MAX_PRODUCERS);
+        const auto d = run_bench(dynamic, p, msgs_per_producer, batch_override);
+        std::cout << p << "         | " << r.rate_billion_per_s << "       | " << d.rate_billion_per_s << "\n";
     }
     return 0;
 }
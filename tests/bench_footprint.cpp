@@ -0,0 +1,101 @@
+// Memory footprint of eager versus lazy ring allocation.
+// Eager mirrors the old Channel layout (every ring value-initialised up front);
+// lazy is today's Channel, which allocates a ring when its slot is registered.
+// Usage: bench_footprint [registered_producers] (default: 3).
+
+#include <ringmpsc.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+using namespace ringmpsc;
+
+namespace {
+
+constexpr Config cfg = high_throughput_config;
+using RingT = Ring<std::uint64_t, cfg>;
+using ChannelT = Channel<std::uint64_t, cfg>;
+
+std::size_t resident_bytes() {
+#if defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    std::size_t total = 0;
+    std::size_t resident = 0;
+    statm >> total >> resident;
+    return resident * static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
+
+// Publishing the allocation keeps the compiler from eliding it.
+const void* volatile sink = nullptr;
+
+struct Sample {
+    double mib = 0.0;
+    double ms = 0.0;
+};
+
+template <typename Fn>
+Sample measure(Fn&& fn) {
+    const auto rss_before = resident_bytes();
+    const auto start = std::chrono::steady_clock::now();
+    auto keep = fn();
+    sink = keep.get();
+    const auto end = std::chrono::steady_clock::now();
+    const auto rss_after = resident_bytes();
+    return {
+        .mib = static_cast<double>(rss_after - rss_before) / (1024.0 * 1024.0),
+        .ms = std::chrono::duration<double, std::milli>(end - start).count(),
+    };
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t registered = 3;
+    if (argc >= 2) {
+        registered = std::strtoull(argv[1], nullptr, 10);
+    }
+    registered = std::min(registered, cfg.max_producers);
+
+    const auto lazy = measure([registered] {
+        auto ch = std::make_unique<ChannelT>();
+        for (std::size_t i = 0; i < registered; ++i) {
+            auto p = ch->register_producer();
+            if (!p) {
+                std::abort();
+            }
+            // Touch the ring the way a producer would.
+            for (std::size_t j = 0; j < RingT::capacity(); j += 512) {
+                if (auto r = p->reserve(512)) {
+                    r->slice[0] = j;
+                    p->commit(512);
+                }
+            }
+        }
+        return ch;
+    });
+
+    const auto eager = measure([] {
+        // Value-initialisation zeroes every ring buffer, as the inline array did.
+        return std::make_unique<std::array<RingT, cfg.max_producers>>();
+    });
+
+    std::cout << "Footprint: ring_bits=" << cfg.ring_bits << " max_producers=" << cfg.max_producers
+              << " registered=" << registered << "\n";
+    std::cout << "Mode  | RSS delta (MiB) | Setup (ms)\n";
+    std::cout << "-------------------------------------\n";
+    std::cout << "eager | " << eager.mib << " | " << eager.ms << "\n";
+    std::cout << "lazy  | " << lazy.mib << " | " << lazy.ms << "\n";
+    return 0;
+}
@@ -0,0 +1,93 @@
+// Producer-side cost of the thread-local path: reserve(1) + commit(1)
+// through a held Channel::Producer versus reserve_local(1) +
+// commit_local(1) and a held local_producer(), and emplace versus
+// emplace_local. Single-threaded: the
+// ring is drained in place whenever it fills, outside the timed loop.
+// Usage: bench_local [msgs] (default: 50_000_000).
+
+#include <ringmpsc.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string_view>
+
+using namespace ringmpsc;
+
+namespace {
+
+constexpr Config cfg{.ring_bits = 12, .max_producers = 4};
+using Ch = Channel<std::uint64_t, cfg>;
+constexpr std::uint64_t capacity = std::uint64_t{1} << cfg.ring_bits;
+
+struct Sink {
+    std::uint64_t sum = 0;
+    void process(std::span<const std::uint64_t> run) {
+        for (auto v : run) {
+            sum += v;
+        }
+    }
+};
+
+// ns per message of push(i), timed per ring-full between drains. make_push
+// gets the fresh channel and returns push.
+template <typename MakePush>
+double run(std::uint64_t msgs, MakePush make_push) {
+    auto ch = std::make_unique<Ch>();
+    auto push = make_push(*ch);
+    Sink sink;
+    double ns = 0.0;
+    for (std::uint64_t sent = 0; sent < msgs; sent += capacity) {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::uint64_t i = 0; i < capacity; ++i) {
+            push(sent + i);
+        }
+        ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        ch->consume_all(sink);
+    }
+    if (sink.sum == 0) {
+        std::cerr << "nothing delivered\n";
+    }
+    return ns / static_cast<double>(msgs);
+}
+
+void print_row(std::string_view path, double ns) { std::cout << path << "\t" << ns << " ns/msg\n"; }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::uint64_t msgs = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 50'000'000;
+
+    std::cout << msgs << " msgs, drained every " << capacity << "\n";
+    print_row("Producer::reserve+commit", run(msgs, [](Ch& ch) {
+                  return [p = *ch.register_producer()](std::uint64_t v) mutable {
+                      if (auto r = p.reserve(1)) {
+                          r->slice[0] = v;
+                          p.commit(1);
+                      }
+                  };
+              }));
+    print_row("reserve_local+commit_local", run(msgs, [](Ch& ch) {
+                  return [&ch](std::uint64_t v) {
+                      if (auto r = ch.reserve_local(1)) {
+                          r->slice[0] = v;
+                          ch.commit_local(*r, 1);
+                      }
+                  };
+              }));
+    print_row("local_producer()->reserve+commit", run(msgs, [](Ch& ch) {
+                  return [p = *ch.local_producer()](std::uint64_t v) mutable {
+                      if (auto r = p.reserve(1)) {
+                          r->slice[0] = v;
+                          p.commit(1);
+                      }
+                  };
+              }));
+    print_row("Producer::emplace", run(msgs, [](Ch& ch) {
+                  return [p = *ch.register_producer()](std::uint64_t v) mutable { p.emplace(v); };
+              }));
+    print_row("emplace_local", run(msgs, [](Ch& ch) { return [&ch](std::uint64_t v) { ch.emplace_local(v); }; }));
+    return 0;
+}
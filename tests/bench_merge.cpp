@@ -0,0 +1,112 @@
+// Consumer cost of global timestamp order across P rings: consume_merged
+// (heap over ring heads) versus consume_all followed by a std::sort of the
+// batch, as downstream re-sorting does today. Single-threaded: each round
+// fills every ring with interleaved timestamps, then drains them.
+// Usage: bench_merge [rounds] (default: 2000).
+
+#include <ringmpsc.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace ringmpsc;
+
+namespace {
+
+constexpr Config cfg{.ring_bits = 12, .max_producers = 64};
+constexpr std::size_t per_round = 2048;
+
+struct Event {
+    std::uint64_t ts;
+    std::uint64_t payload;
+};
+
+struct Rng {
+    std::uint64_t state = 0x9e3779b97f4a7c15;
+    std::uint64_t next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+struct Checksum {
+    std::uint64_t sum = 0;
+    std::uint64_t last = 0;
+    bool ordered = true;
+    void process(std::span<const Event> run) {
+        for (const auto& e : run) {
+            ordered = ordered && e.ts >= last;
+            last = e.ts;
+            sum += e.payload;
+        }
+    }
+};
+
+struct Collect {
+    std::vector<Event>* batch;
+    void process(std::span<const Event> run) { batch->insert(batch->end(), run.begin(), run.end()); }
+};
+
+void fill(std::vector<Channel<Event, cfg>::Producer>& producers, Rng& rng, std::uint64_t& ts) {
+    for (std::size_t i = 0; i < per_round; ++i) {
+        producers[rng.next() % producers.size()].emplace(Event{.ts = ++ts, .payload = i});
+    }
+}
+
+void run(std::size_t p, std::uint64_t rounds) {
+    auto ch = std::make_unique<Channel<Event, cfg>>();
+    std::vector<Channel<Event, cfg>::Producer> producers;
+    for (std::size_t i = 0; i < p; ++i) {
+        producers.push_back(*ch->register_producer());
+    }
+
+    Rng rng;
+    std::uint64_t ts = 0;
+    Checksum merged;
+    double merge_ns = 0.0;
+    for (std::uint64_t r = 0; r < rounds; ++r) {
+        fill(producers, rng, ts);
+        const auto start = std::chrono::steady_clock::now();
+        while (ch->consume_merged(&Event::ts, merged) != 0) {
+        }
+        merge_ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::vector<Event> batch;
+    batch.reserve(per_round);
+    Checksum sorted;
+    double sort_ns = 0.0;
+    for (std::uint64_t r = 0; r < rounds; ++r) {
+        fill(producers, rng, ts);
+        const auto start = std::chrono::steady_clock::now();
+        batch.clear();
+        ch->consume_all(Collect{.batch = &batch});
+        std::ranges::sort(batch, {}, &Event::ts);
+        sorted.process(batch);
+        sort_ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    const auto msgs = static_cast<double>(rounds * per_round);
+    std::cout << p << "\t" << merge_ns / msgs << "\t" << sort_ns / msgs << "\t"
+              << (merged.ordered && sorted.ordered ? "ok" : "OUT OF ORDER") << "\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::uint64_t rounds = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000;
+
+    std::cout << "ns per message, " << per_round << " messages per round\n";
+    std::cout << "rings\tmerged\tconsume_all+sort\torder\n";
+    for (const std::size_t p : {2, 4, 8, 16, 32, 64}) {
+        run(p, rounds);
+    }
+    return 0;
+}
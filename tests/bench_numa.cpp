@@ -0,0 +1,156 @@
+// NUMA placement matrix: one producer and one consumer pinned to chosen
+// nodes, with the ring placed producer-local, consumer-local, interleaved or
+// left to first touch. Cross-node rows show the interconnect cost.
+// Usage: bench_numa [msgs] (default: 20_000_000).
+
+#include <ringmpsc.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+using namespace ringmpsc;
+
+namespace {
+
+constexpr Config cfg{.ring_bits = 16, .max_producers = 2};
+constexpr std::size_t BATCH = 8192;
+
+// CPUs of a node parsed from sysfs ("0-3,8-11"); empty if the node is absent.
+std::vector<int> node_cpus(int node) {
+    std::vector<int> cpus;
+    std::ifstream in("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    std::string list;
+    if (!std::getline(in, list)) {
+        return cpus;
+    }
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        const auto dash = range.find('-');
+        const int lo = std::stoi(range.substr(0, dash));
+        const int hi = dash == std::string::npos ? lo : std::stoi(range.substr(dash + 1));
+        for (int c = lo; c <= hi; ++c) {
+            cpus.push_back(c);
+        }
+    }
+    return cpus;
+}
+
+void pin_to(const std::vector<int>& cpus, std::size_t index) {
+#if defined(__linux__)
+    if (cpus.empty()) {
+        return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpus[index % cpus.size()], &set);
+    ::sched_setaffinity(0, sizeof(set), &set);
+#else
+    (void)cpus;
+    (void)index;
+#endif
+}
+
+double run(int producer_node, int consumer_node, const Placement& placement, std::uint64_t msgs) {
+    const auto producer_cpus = node_cpus(producer_node);
+    const auto consumer_cpus = node_cpus(consumer_node);
+    DynamicChannel<std::uint64_t, cfg> channel;
+
+    // Register from the producer's node so Placement::local() means producer-local.
+    std::optional<DynamicChannel<std::uint64_t, cfg>::Producer> producer;
+    std::thread([&] {
+        pin_to(producer_cpus, 0);
+        producer = channel.register_producer(placement).value();
+    }).join();
+
+    std::uint64_t received = 0;
+    std::thread consumer([&] {
+        pin_to(consumer_cpus, producer_node == consumer_node ? 1 : 0);
+        struct Handler {
+            std::uint64_t* count;
+            void process(const std::uint64_t*) { ++*count; }
+        } handler{.count = &received};
+        while (received < msgs) {
+            if (channel.consume_all(handler) == 0) {
+                detail::cpu_relax();
+            }
+        }
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    std::thread producer_thread([&] {
+        pin_to(producer_cpus, 0);
+        std::uint64_t sent = 0;
+        while (sent < msgs) {
+            const auto want = std::min<std::uint64_t>(BATCH, msgs - sent);
+            if (auto r = producer->reserve(static_cast<std::size_t>(want))) {
+                for (std::size_t j = 0; j < r->slice.size(); ++j) {
+                    r->slice[j] = sent + j;
+                }
+                producer->commit(r->slice.size());
+                sent += r->slice.size();
+            } else {
+                detail::cpu_relax();
+            }
+        }
+    });
+    producer_thread.join();
+    consumer.join();
+    const auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(msgs) / ns; // B msg/s
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::uint64_t msgs = 20'000'000;
+    if (argc >= 2) {
+        msgs = std::strtoull(argv[1], nullptr, 10);
+    }
+
+    std::vector<int> nodes;
+    for (int n = 0; n < 64; ++n) {
+        if (!node_cpus(n).empty()) {
+            nodes.push_back(n);
+        }
+    }
+    if (nodes.empty()) {
+        nodes.push_back(0);
+    }
+
+    struct Named {
+        const char* name;
+        Placement placement;
+    };
+
+    std::cout << "NUMA matrix: nodes=" << nodes.size() << " msgs=" << msgs << "\n";
+    std::cout << "Producer node | Consumer node | Placement      | Throughput (B msg/s)\n";
+    std::cout << "---------------------------------------------------------------------\n";
+    for (int pn : nodes) {
+        for (int cn : nodes) {
+            const Named placements[] = {
+                {"first-touch   ", Placement{}},
+                {"producer-local", Placement::local()},
+                {"consumer-local", Placement::on_node(cn)},
+                {"interleaved   ", Placement::interleaved()},
+            };
+            for (const auto& p : placements) {
+                std::cout << pn << "             | " << cn << "             | " << p.name << " | "
+                          << run(pn, cn, p.placement, msgs) << "\n";
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,123 @@
+// Producer latency of the lossy modes (OverwriteRing, and Ring with
+// Config::drop_newest) versus Ring while the consumer keeps up, is
+// periodically descheduled (sleeps 1 ms of every 2), or never runs. Latency
+// is sampled per window of 256 messages; plain Ring retries a failed
+// reserve, so a stalled consumer shows up in its tail.
+// Usage: bench_overwrite [msgs] (default: 10_000_000).
+
+#include <ringmpsc.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace ringmpsc;
+
+namespace {
+
+constexpr Config cfg{.ring_bits = 12, .max_producers = 1};
+constexpr Config drop_cfg{.ring_bits = 12, .max_producers = 1, .drop_newest = true};
+constexpr std::uint64_t window = 256;
+
+enum class Consumer { Running, Stalling, Absent };
+
+struct Result {
+    double p50_ns = 0.0;
+    double p99_ns = 0.0;
+    double max_ns = 0.0;
+    std::uint64_t lost = 0;  // Overruns or drops
+};
+
+template <typename RingT, typename Push>
+Result run(std::uint64_t msgs, Consumer mode, Push push) {
+    using Clock = std::chrono::steady_clock;
+    auto ring = std::make_unique<RingT>();
+    std::atomic<bool> done{false};
+
+    std::thread consumer([&] {
+        struct Handler {
+            void process(const std::uint64_t*) {}
+        };
+        if (mode == Consumer::Absent) {
+            return;
+        }
+        auto next_stall = Clock::now() + std::chrono::milliseconds(1);
+        while (!done.load(std::memory_order_relaxed)) {
+            if (ring->consume_batch(Handler{}) == 0) {
+                detail::cpu_relax();
+            }
+            if (mode == Consumer::Stalling && Clock::now() >= next_stall) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                next_stall = Clock::now() + std::chrono::milliseconds(1);
+            }
+        }
+    });
+
+    std::vector<double> samples;
+    samples.reserve(msgs / window + 1);
+    auto last = Clock::now();
+    for (std::uint64_t i = 0; i < msgs; ++i) {
+        push(*ring, i);
+        if ((i + 1) % window == 0) {
+            const auto now = Clock::now();
+            samples.push_back(std::chrono::duration<double, std::nano>(now - last).count() / window);
+            last = now;
+        }
+    }
+    done.store(true, std::memory_order_relaxed);
+    consumer.join();
+
+    std::ranges::sort(samples);
+    Result r{
+        .p50_ns = samples[samples.size() / 2],
+        .p99_ns = samples[samples.size() * 99 / 100],
+        .max_ns = samples.back(),
+    };
+    if constexpr (requires { ring->overruns(); }) {
+        // The consumer thread has exited; drain so the count covers the tail.
+        std::uint64_t sink[64];
+        while (ring->recv(sink) != 0) {
+        }
+    }
+    const auto m = ring->get_metrics();
+    r.lost = m.overruns + m.drops;
+    return r;
+}
+
+void print_row(std::string_view ring, std::string_view consumer, const Result& r) {
+    std::cout << ring << "\t" << consumer << "\t" << r.p50_ns << "\t" << r.p99_ns << "\t" << r.max_ns << "\t"
+              << r.lost << "\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::uint64_t msgs = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+
+    const auto overwrite = [](OverwriteRing<std::uint64_t, cfg>& ring, std::uint64_t v) { ring.push(v); };
+    const auto drop = [](Ring<std::uint64_t, drop_cfg>& ring, std::uint64_t v) { ring.emplace(v); };
+    const auto blocking = [](Ring<std::uint64_t, cfg>& ring, std::uint64_t v) {
+        while (!ring.emplace(v)) {
+            detail::cpu_relax();
+        }
+    };
+
+    std::cout << "ns per push over " << window << "-message windows, " << msgs << " msgs\n";
+    std::cout << "ring\tconsumer\tp50\tp99\tmax\tlost\n";
+    print_row("overwrite", "running", run<OverwriteRing<std::uint64_t, cfg>>(msgs, Consumer::Running, overwrite));
+    print_row("overwrite", "stalling", run<OverwriteRing<std::uint64_t, cfg>>(msgs, Consumer::Stalling, overwrite));
+    print_row("overwrite", "absent", run<OverwriteRing<std::uint64_t, cfg>>(msgs, Consumer::Absent, overwrite));
+    print_row("drop", "running", run<Ring<std::uint64_t, drop_cfg>>(msgs, Consumer::Running, drop));
+    print_row("drop", "stalling", run<Ring<std::uint64_t, drop_cfg>>(msgs, Consumer::Stalling, drop));
+    print_row("drop", "absent", run<Ring<std::uint64_t, drop_cfg>>(msgs, Consumer::Absent, drop));
+    print_row("ring", "running", run<Ring<std::uint64_t, cfg>>(msgs, Consumer::Running, blocking));
+    print_row("ring", "stalling", run<Ring<std::uint64_t, cfg>>(msgs, Consumer::Stalling, blocking));
+    return 0;
+}
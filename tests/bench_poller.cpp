@@ -0,0 +1,129 @@
+// One consumer thread over 16 channels, one of them busy: calling each
+// channel's consume_all in turn versus a Poller, as idle-pass cost and as
+// throughput. Then the Poller parked in poll_wait with a producer sending a
+// message every 100 us, reporting wake-to-handler latency.
+// Usage: bench_poller [msgs] (default: 5_000_000).
+
+#include <ringmpsc.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace ringmpsc;
+
+namespace {
+
+constexpr std::size_t channels = 16;
+constexpr Config cfg{.ring_bits = 12, .max_producers = 2};
+using Ch = Channel<std::int64_t, cfg>;
+
+std::int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+struct Counter {
+    std::uint64_t* count;
+    void process(const std::int64_t*) { ++*count; }
+};
+
+struct Latency {
+    std::vector<std::int64_t>* samples;
+    void process(const std::int64_t* sent) { samples->push_back(now_ns() - *sent); }
+};
+
+template <typename Pass>
+double idle_pass_ns(Pass&& pass) {
+    constexpr int passes = 1'000'000;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < passes; ++i) {
+        pass();
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / passes;
+}
+
+template <typename Pass>
+double throughput(Ch& busy, std::uint64_t msgs, const std::uint64_t& count, Pass&& pass) {
+    const auto start = std::chrono::steady_clock::now();
+    const auto target = count + msgs;
+    std::thread producer([p = *busy.register_producer(), msgs]() mutable {
+        for (std::uint64_t sent = 0; sent < msgs;) {
+            if (p.emplace(static_cast<std::int64_t>(sent))) {
+                ++sent;
+            } else {
+                detail::cpu_relax();
+            }
+        }
+    });
+    while (count < target) {
+        if (pass() == 0) {
+            detail::cpu_relax();
+        }
+    }
+    producer.join();
+    const auto secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(msgs) / secs / 1e6;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::uint64_t msgs = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5'000'000;
+
+    std::array<std::unique_ptr<Ch>, channels> in_turn;
+    std::array<std::unique_ptr<Ch>, channels> polled;
+    for (std::size_t i = 0; i < channels; ++i) {
+        in_turn[i] = std::make_unique<Ch>();
+        polled[i] = std::make_unique<Ch>();
+    }
+
+    std::uint64_t count = 0;
+    const auto each = [&] {
+        std::size_t n = 0;
+        for (auto& ch : in_turn) {
+            n += ch->consume_all(Counter{.count = &count});
+        }
+        return n;
+    };
+    Poller poller;
+    for (auto& ch : polled) {
+        poller.add(*ch, Counter{.count = &count});
+    }
+
+    const auto each_idle = idle_pass_ns(each);
+    const auto poller_idle = idle_pass_ns([&] { return poller.poll(); });
+    const auto each_rate = throughput(*in_turn[7], msgs, count, each);
+    const auto poller_rate = throughput(*polled[7], msgs, count, [&] { return poller.poll(); });
+
+    std::cout << channels << " channels, 1 busy, " << msgs << " msgs\n";
+    std::cout << "consume_all in turn\t" << each_idle << " ns/idle pass\t" << each_rate << " M msg/s\n";
+    std::cout << "poller\t" << poller_idle << " ns/idle pass\t" << poller_rate << " M msg/s\n";
+
+    // Parked consumer: one wait over all channels.
+    auto sleepy = std::make_unique<Ch>();
+    std::vector<std::int64_t> samples;
+    Poller waiting;
+    waiting.add(*sleepy, Latency{.samples = &samples});
+    constexpr int wakes = 2000;
+    std::thread producer([p = *sleepy->register_producer()]() mutable {
+        for (int i = 0; i < wakes; ++i) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            p.emplace(now_ns());
+        }
+    });
+    while (samples.size() < wakes) {
+        waiting.poll_wait();
+    }
+    producer.join();
+    std::ranges::sort(samples);
+    std::cout << "poll_wait wake latency p50 " << static_cast<double>(samples[samples.size() / 2]) / 1e3 << " us, p99 "
+              << static_cast<double>(samples[samples.size() * 99 / 100]) / 1e3 << " us\n";
+    return 0;
+}
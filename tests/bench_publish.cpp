@@ -0,0 +1,161 @@
+// Publication policies.
+// Tail: per-message producer cost of immediate versus deferred publication,
+// one producer committing single messages while a consumer polls the ring.
+// Head: producer reserve failures against a slow consumer when the head is
+// published once per batch, every 256 items, or every 25% of capacity.
+// Usage: bench_publish [msgs] (default: 20_000_000). bench_publish_fence is
+// this file built with RINGMPSC_NO_MEMBARRIER, the full-fence fallback.
+
+#include <ringmpsc.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#endif
+
+using namespace ringmpsc;
+
+namespace {
+
+std::uint64_t cycles() {
+#if defined(__x86_64__) || defined(_M_X64)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+struct Result {
+    double ns_per_msg = 0.0;
+    double cycles_per_msg = 0.0;
+};
+
+template <Config cfg>
+Result run(std::uint64_t msgs) {
+    auto ring = std::make_unique<Ring<std::uint64_t, cfg>>();
+
+    std::thread consumer([&] {
+        struct Handler {
+            std::uint64_t count = 0;
+            void process(const std::uint64_t*) { ++count; }
+        } handler;
+        while (handler.count < msgs) {
+            if (ring->consume_batch(handler) == 0) {
+                detail::cpu_relax();
+            }
+        }
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto c0 = cycles();
+    for (std::uint64_t i = 0; i < msgs;) {
+        if (auto r = ring->reserve(1)) {
+            r->slice[0] = i++;
+            ring->commit(1);
+        } else {
+            detail::cpu_relax();
+        }
+    }
+    ring->flush();
+    const auto c1 = cycles();
+    const auto end = std::chrono::steady_clock::now();
+    consumer.join();
+
+    const auto n = static_cast<double>(msgs);
+    return {
+        .ns_per_msg = std::chrono::duration<double, std::nano>(end - start).count() / n,
+        .cycles_per_msg = static_cast<double>(c1 - c0) / n,
+    };
+}
+
+struct HeadResult {
+    std::uint64_t reserve_failures = 0;
+    double ms = 0.0;
+};
+
+template <Config cfg>
+HeadResult run_head(std::uint64_t msgs) {
+    constexpr std::size_t BATCH = 256;
+    auto ring = std::make_unique<Ring<std::uint64_t, cfg>>();
+
+    std::thread consumer([&] {
+        // Stands in for per-message work that keeps the batch open.
+        struct SlowHandler {
+            std::uint64_t count = 0;
+            void process(const std::uint64_t*) {
+                for (int i = 0; i < 16; ++i) {
+                    detail::cpu_relax();
+                }
+                ++count;
+            }
+        } handler;
+        while (handler.count < msgs) {
+            if (ring->consume_batch(handler) == 0) {
+                detail::cpu_relax();
+            }
+        }
+    });
+
+    HeadResult result;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::uint64_t sent = 0; sent < msgs;) {
+        const auto want = static_cast<std::size_t>(std::min<std::uint64_t>(BATCH, msgs - sent));
+        if (auto r = ring->reserve(want)) {
+            for (std::size_t j = 0; j < r->slice.size(); ++j) {
+                r->slice[j] = sent + j;
+            }
+            ring->commit(r->slice.size());
+            sent += r->slice.size();
+        } else {
+            ++result.reserve_failures;
+            detail::cpu_relax();
+        }
+    }
+    consumer.join();
+    result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+void print_head(const char* name, const HeadResult& r) {
+    std::cout << name << " | " << r.reserve_failures << " | " << r.ms << "\n";
+}
+
+void print(const char* name, const Result& r) {
+    std::cout << name << " | " << r.ns_per_msg << " | ";
+    if (r.cycles_per_msg > 0.0) {
+        std::cout << r.cycles_per_msg;
+    } else {
+        std::cout << "n/a";
+    }
+    std::cout << "\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::uint64_t msgs = 20'000'000;
+    if (argc >= 2) {
+        msgs = std::strtoull(argv[1], nullptr, 10);
+    }
+
+    std::cout << "Tail publication: msgs=" << msgs << "\n";
+    std::cout << "Mode                 | ns/msg | cycles/msg (TSC)\n";
+    std::cout << "-----------------------------------------------\n";
+    print("immediate (every=1) ", run<Config{.ring_bits = 16}>(msgs));
+    print("deferred  (every=64)", run<Config{.ring_bits = 16, .tail_publish_every = 64}>(msgs));
+
+    const auto head_msgs = msgs / 10;
+    std::cout << "\nHead publication: msgs=" << head_msgs << " ring_bits=14\n";
+    std::cout << "Policy          | Reserve failures | Time (ms)\n";
+    std::cout << "-----------------------------------------------\n";
+    print_head("per batch      ", run_head<Config{.ring_bits = 14}>(head_msgs));
+    print_head("every 256 items", run_head<Config{.ring_bits = 14, .head_publish_every = 256}>(head_msgs));
+    print_head("every 25%      ", run_head<Config{.ring_bits = 14, .head_publish_percent = 25}>(head_msgs));
+    return 0;
+}
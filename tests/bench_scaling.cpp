@@ -0,0 +1,94 @@
+// Producer-count scaling with sparse activity: 64 to 4096 registered
+// producers on a DynamicChannel, 4 of them sending. Reports the cost of an
+// idle consume_all pass (group bitmap, then ready words) next to a walk
+// over every ring, and consume_all throughput.
+// Usage: bench_scaling [msgs_per_active_producer] (default: 2_000_000).
+
+#include <ringmpsc.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace ringmpsc;
+
+namespace {
+
+constexpr std::size_t active = 4;
+constexpr Config cfg{.ring_bits = 10, .max_producers = 4096};
+using Ch = DynamicChannel<std::uint64_t, cfg>;
+
+struct Counter {
+    std::uint64_t count = 0;
+    void process(const std::uint64_t*) { ++count; }
+};
+
+template <typename Pass>
+double idle_pass_ns(Pass&& pass) {
+    constexpr int passes = 200'000;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < passes; ++i) {
+        pass();
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / passes;
+}
+
+void run(std::size_t registered, std::uint64_t msgs) {
+    Ch ch(std::size_t{1} << cfg.ring_bits, registered);
+    std::vector<Ch::Producer> producers;
+    for (std::size_t i = 0; i < registered; ++i) {
+        producers.push_back(*ch.register_producer());
+    }
+
+    Counter idle;
+    const auto walk_ns = idle_pass_ns([&] {
+        for (auto& p : producers) {
+            p.ring->consume_batch(idle);
+        }
+    });
+    const auto bitmap_ns = idle_pass_ns([&] { return ch.consume_all(idle); });
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < active; ++i) {
+        // Spread the active rings across the groups.
+        threads.emplace_back([p = producers[i * (registered / active)], msgs]() mutable {
+            for (std::uint64_t sent = 0; sent < msgs;) {
+                if (p.emplace(sent)) {
+                    ++sent;
+                } else {
+                    detail::cpu_relax();
+                }
+            }
+        });
+    }
+    Counter handler;
+    while (handler.count < msgs * active) {
+        if (ch.consume_all(handler) == 0) {
+            detail::cpu_relax();
+        }
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    const auto secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << registered << "\t" << walk_ns << "\t" << bitmap_ns << "\t"
+              << static_cast<double>(msgs * active) / secs / 1e6 << "\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::uint64_t msgs = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2'000'000;
+
+    std::cout << active << " active producers, " << msgs << " msgs each\n";
+    std::cout << "registered\twalk ns/idle pass\tconsume_all ns/idle pass\tM msg/s\n";
+    for (const std::size_t registered : {64, 256, 1024, 4096}) {
+        run(registered, msgs);
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+// Cost of Config::sequence_stamps: P producers sending batches of B items
+// through an unordered Channel, a stamped Channel drained by consume_all,
+// and a stamped Channel drained in total order by consume_sequenced. Each
+// commit takes its B tickets with one fetch_add on the shared counter.
+// Usage: bench_sequence [msgs_per_producer] (default: 2_000_000).
+
+#include <ringmpsc.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace ringmpsc;
+
+namespace {
+
+constexpr Config plain_cfg{.ring_bits = 14, .max_producers = 8};
+constexpr Config stamped_cfg{.ring_bits = 14, .max_producers = 8, .sequence_stamps = true};
+
+enum class Drain { All, Sequenced };
+
+struct Counter {
+    std::uint64_t count = 0;
+    void process(std::span<const std::uint64_t> run) { count += run.size(); }
+};
+
+template <Config cfg>
+double run(std::size_t producers, std::size_t batch, std::uint64_t msgs, Drain drain) {
+    auto ch = std::make_unique<Channel<std::uint64_t, cfg>>();
+    std::vector<typename Channel<std::uint64_t, cfg>::Producer> regs;
+    for (std::size_t i = 0; i < producers; ++i) {
+        regs.push_back(*ch->register_producer());
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (auto& p : regs) {
+        threads.emplace_back([p, batch, msgs]() mutable {
+            for (std::uint64_t sent = 0; sent < msgs;) {
+                if (auto r = p.reserve(std::min<std::uint64_t>(batch, msgs - sent))) {
+                    for (auto& item : r->slice) {
+                        item = sent++;
+                    }
+                    p.commit(r->slice.size());
+                } else {
+                    detail::cpu_relax();
+                }
+            }
+        });
+    }
+
+    Counter handler;
+    while (handler.count < msgs * producers) {
+        std::size_t n = 0;
+        if constexpr (cfg.sequence_stamps) {
+            n = drain == Drain::Sequenced ? ch->consume_sequenced(handler) : ch->consume_all(handler);
+        } else {
+            n = ch->consume_all(handler);
+        }
+        if (n == 0) {
+            detail::cpu_relax();
+        }
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    const auto secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(msgs * producers) / secs / 1e6;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::uint64_t msgs = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2'000'000;
+
+    std::cout << "M msg/s, " << msgs << " msgs per producer\n";
+    std::cout << "producers\tbatch\tunordered\tstamped\tstamped+sequenced\n";
+    for (const std::size_t p : {1, 2, 4, 8}) {
+        for (const std::size_t batch : {1, 64}) {
+            std::cout << p << "\t" << batch << "\t" << run<plain_cfg>(p, batch, msgs, Drain::All) << "\t"
+                      << run<stamped_cfg>(p, batch, msgs, Drain::All) << "\t"
+                      << run<stamped_cfg>(p, batch, msgs, Drain::Sequenced) << "\n";
+        }
+    }
+    return 0;
+}
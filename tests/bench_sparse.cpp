@@ -0,0 +1,105 @@
+// Sparse activity: 64 registered producers, 4 of them sending. Compares
+// Channel::consume_all (ready bitmap) with a consumer that walks every ring,
+// first as the cost of a pass while idle, then as throughput.
+// Usage: bench_sparse [msgs_per_active_producer] (default: 5_000_000).
+
+#include <ringmpsc.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace ringmpsc;
+
+namespace {
+
+constexpr std::size_t registered = 64;
+constexpr std::size_t active = 4;
+constexpr Config cfg{.ring_bits = 12, .max_producers = registered};
+using Ch = Channel<std::uint64_t, cfg>;
+
+struct Counter {
+    std::uint64_t count = 0;
+    void process(const std::uint64_t*) { ++count; }
+};
+
+// The pre-bitmap consumer: load every ring's indices on every pass.
+std::size_t walk_all(std::vector<Ch::Producer>& producers, Counter& handler) {
+    std::size_t total = 0;
+    for (auto& p : producers) {
+        total += p.ring->consume_batch(handler);
+    }
+    return total;
+}
+
+template <typename Pass>
+double idle_pass_ns(Pass&& pass) {
+    constexpr int passes = 1'000'000;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < passes; ++i) {
+        pass();
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / passes;
+}
+
+template <typename Pass>
+double throughput(std::vector<Ch::Producer>& producers, std::uint64_t msgs, Pass&& pass) {
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < active; ++i) {
+        // Spread the active rings across the table.
+        threads.emplace_back([p = producers[i * (registered / active)], msgs]() mutable {
+            for (std::uint64_t sent = 0; sent < msgs;) {
+                if (p.emplace(sent)) {
+                    ++sent;
+                } else {
+                    detail::cpu_relax();
+                }
+            }
+        });
+    }
+
+    Counter handler;
+    while (handler.count < msgs * active) {
+        if (pass(handler) == 0) {
+            detail::cpu_relax();
+        }
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    const auto secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(msgs * active) / secs / 1e6;
+}
+
+void print_row(std::string_view mode, double idle_ns, double mmsgs) {
+    std::cout << mode << "\t" << idle_ns << " ns/idle pass\t" << mmsgs << " M msg/s\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::uint64_t msgs = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5'000'000;
+
+    auto ch = std::make_unique<Ch>();
+    std::vector<Ch::Producer> producers;
+    for (std::size_t i = 0; i < registered; ++i) {
+        producers.push_back(*ch->register_producer());
+    }
+
+    Counter idle;
+    const auto scan_idle = idle_pass_ns([&] { return walk_all(producers, idle); });
+    const auto scan_rate = throughput(producers, msgs, [&](Counter& h) { return walk_all(producers, h); });
+    const auto bitmap_idle = idle_pass_ns([&] { return ch->consume_all(idle); });
+    const auto bitmap_rate = throughput(producers, msgs, [&](Counter& h) { return ch->consume_all(h); });
+
+    std::cout << registered << " producers registered, " << active << " active, " << msgs << " msgs each\n";
+    print_row("walk every ring", scan_idle, scan_rate);
+    print_row("ready bitmap", bitmap_idle, bitmap_rate);
+    return 0;
+}
@@ -3,14 +3,27 @@
 #include <ringmpsc.hpp>
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <cstring>
 #include <exception>
 #include <iostream>
+#include <memory>
+#include <new>
+#include <numeric>
 #include <span>
+#include <string>
 #include <string_view>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#if defined(__linux__)
+#include <poll.h>
+#include <unistd.h>
+#endif
+
 using namespace ringmpsc;
 
 namespace {
@@ -48,6 +61,16 @@ bool all_equal(std::span<const T> lhs, std::span<const T> rhs) {
     return true;
 }
 
+// Non-trivial message type that counts live instances.
+struct Tracked {
+    static inline int live = 0;
+    std::string text;
+    explicit Tracked(std::string t) : text(std::move(t)) { ++live; }
+    Tracked(const Tracked& o) : text(o.text) { ++live; }
+    Tracked& operator=(const Tracked&) = default;
+    ~Tracked() { --live; }
+};
+
 } // namespace
 
 int main() {
@@ -155,6 +178,1129 @@ int main() {
         expect(sum == 21, "sum should be 21");
     });
 
+    tr.run("channel: rings allocated on registration", [] {
+        static_assert(sizeof(Channel<std::uint64_t>) < sizeof(Ring<std::uint64_t>),
+                      "channel should not embed its rings");
+        Channel<std::uint64_t, Config{.ring_bits = 8, .max_producers = 4}> ch;
+
+        std::array<std::uint64_t, 4> out{};
+        expect(ch.recv(out) == 0, "empty channel should receive nothing");
+
+        auto p1 = ch.register_producer();
+        auto p2 = ch.register_producer();
+        expect(p1 && p2, "producers should register");
+        expect(p1->ring != nullptr && p1->ring != p2->ring, "each producer should get its own ring");
+
+        expect(p2->send(std::span<const std::uint64_t>{std::array<std::uint64_t, 1>{7}}) == 1, "p2 send");
+        expect(ch.recv(out) == 1 && out[0] == 7, "should receive from the second ring");
+
+        ch.close();
+        expect(p1->ring->is_closed() && p2->ring->is_closed(), "close should reach allocated rings");
+        expect(!ch.register_producer() &&
+                   ch.register_producer().error() ==
+                       Channel<std::uint64_t, Config{.ring_bits = 8, .max_producers = 4}>::RegisterError::Closed,
+               "registration after close should fail");
+    });
+
+    tr.run("dynamic ring: oversized capacity is refused", [] {
+        const auto refused = [](auto make) {
+            try {
+                make();
+            } catch (const std::bad_alloc&) {
+                return true;
+            }
+            return false;
+        };
+        expect(refused([] { DynamicRing<std::uint64_t> ring(std::size_t{1} << 62); }),
+               "a capacity whose byte size wraps should be refused");
+        expect(refused([] { DynamicRing<std::uint64_t> ring(SIZE_MAX); }),
+               "a capacity that cannot round up should be refused");
+#if defined(__linux__)
+        using Mirrored = DynamicRing<std::uint64_t, Config{.memory = MemoryPolicy::Mirrored}>;
+        expect(refused([] { Mirrored ring(std::size_t{1} << 61); }),
+               "a mirrored capacity whose double mapping wraps should be refused");
+#endif
+
+        using Ch = DynamicChannel<std::uint64_t>;
+        Ch ch(std::size_t{1} << 62, 1);
+        auto p = ch.register_producer();
+        expect(!p && p.error() == Ch::RegisterError::OutOfMemory, "an oversized ring should fail to register");
+    });
+
+    tr.run("dynamic ring: runtime capacity and wrap", [] {
+        DynamicRing<std::uint64_t> ring(100);
+        expect(ring.capacity() == 128, "capacity should round up to a power of two");
+        expect(ring.mask() == 127, "mask should follow capacity");
+
+        std::uint64_t next = 0;
+        std::uint64_t expected = 0;
+        for (int round = 0; round < 5; ++round) {
+            for (std::size_t i = 0; i < 100; ++i) {
+                auto w = ring.reserve(1);
+                expect(w.has_value(), "reserve should succeed");
+                w->slice[0] = next++;
+                ring.commit(1);
+            }
+            std::array<std::uint64_t, 100> out{};
+            std::size_t got = 0;
+            while (got < out.size()) {
+                got += ring.recv(std::span<std::uint64_t>{out}.subspan(got));
+            }
+            for (auto v : out) {
+                expect(v == expected++, "values should arrive in order across the wrap");
+            }
+        }
+        expect(ring.is_empty(), "ring should be empty");
+    });
+
+    tr.run("dynamic channel: failed allocation does not use up the slot", [] {
+        using Ch = DynamicChannel<std::uint64_t>;
+        Ch ch(std::size_t{1} << 60, 1);
+        for (int i = 0; i < 3; ++i) {
+            auto p = ch.register_producer();
+            expect(!p && p.error() == Ch::RegisterError::OutOfMemory, "an impossible ring should fail to allocate");
+        }
+        expect(ch.producer_count() == 1, "the failed id is reused, not burned");
+        std::array<std::uint64_t, 4> out{};
+        expect(ch.recv(out) == 0, "the empty slot is skipped");
+    });
+
+    tr.run("dynamic channel: runtime producer limit", [] {
+        DynamicChannel<std::uint64_t> ch(1024, 2);
+        expect(ch.max_producers() == 2, "max producers should match constructor");
+
+        auto p1 = ch.register_producer();
+        auto p2 = ch.register_producer();
+        auto p3 = ch.register_producer();
+        expect(p1 && p2, "first two producers should register");
+        expect(!p3 && p3.error() == DynamicChannel<std::uint64_t>::RegisterError::TooManyProducers,
+               "third producer should be rejected");
+        expect(p1->ring->capacity() == 1024, "ring capacity should match constructor");
+
+        expect(p1->send(std::span<const std::uint64_t>{std::array<std::uint64_t, 2>{1, 2}}) == 2, "p1 send");
+        expect(p2->send(std::span<const std::uint64_t>{std::array<std::uint64_t, 2>{3, 4}}) == 2, "p2 send");
+
+        std::uint64_t sum = 0;
+        struct Handler {
+            std::uint64_t* sum;
+            void process(const std::uint64_t* item) { *sum += *item; }
+        };
+        expect(ch.consume_all(Handler{.sum = &sum}) == 4, "should consume 4 items");
+        expect(sum == 10, "sum should be 10");
+    });
+
+    tr.run("memory policy: huge pages degrade cleanly", [] {
+        constexpr Config cfg{.ring_bits = 10, .max_producers = 2, .memory = MemoryPolicy::HugePages};
+
+        DynamicRing<std::uint64_t, cfg> ring;
+        expect(ring.send(std::span<const std::uint64_t>{std::array<std::uint64_t, 3>{1, 2, 3}}) == 3, "ring send");
+        std::array<std::uint64_t, 3> out{};
+        expect(ring.recv(out) == 3 && out[2] == 3, "ring recv");
+
+        Channel<std::uint64_t, cfg> ch;
+        auto p = ch.register_producer();
+        expect(p.has_value(), "producer should register");
+        expect(p->send(std::span<const std::uint64_t>{std::array<std::uint64_t, 2>{4, 5}}) == 2, "channel send");
+        expect(ch.recv(out) == 2 && out[0] == 4 && out[1] == 5, "channel recv");
+    });
+
+    tr.run("memory policy: mirrored ring never splits at the wrap", [] {
+        constexpr Config cfg{.ring_bits = 9, .memory = MemoryPolicy::Mirrored};
+        DynamicRing<std::uint64_t, cfg> ring;
+        const auto cap = ring.capacity();
+        expect(cap >= 512 && (cap * sizeof(std::uint64_t)) % 4096 == 0, "capacity should cover whole pages");
+
+        // Park head and tail just before the end of the buffer.
+        const auto lead = cap - 3;
+        for (std::size_t i = 0; i < lead; ++i) {
+            auto w = ring.reserve(1);
+            expect(w.has_value(), "lead reserve should succeed");
+            ring.commit(1);
+        }
+        ring.advance(lead);
+
+        auto w = ring.reserve(10);
+        expect(w.has_value() && w->slice.size() == 10, "reservation should span the wrap");
+        for (std::size_t i = 0; i < 10; ++i) {
+            w->slice[i] = 100 + i;
+        }
+        ring.commit(10);
+
+        auto r = ring.readable();
+        expect(r.has_value() && r->size() == 10, "readable should span the wrap");
+        for (std::size_t i = 0; i < 10; ++i) {
+            expect((*r)[i] == 100 + i, "values should match across the wrap");
+        }
+        ring.advance(10);
+        expect(ring.is_empty(), "ring should be empty");
+    });
+
+    tr.run("numa: placement hints keep rings usable", [] {
+        DynamicChannel<std::uint64_t> ch(1024, 4);
+        const Placement hints[] = {Placement{}, Placement::local(), Placement::on_node(current_numa_node()),
+                                   Placement::interleaved()};
+        std::uint64_t v = 0;
+        for (const auto& hint : hints) {
+            auto p = ch.register_producer(hint);
+            expect(p.has_value(), "producer should register with a placement hint");
+            expect(p->send(std::span<const std::uint64_t>{std::array<std::uint64_t, 1>{++v}}) == 1, "send");
+        }
+        std::array<std::uint64_t, 8> out{};
+        expect(ch.recv(out) == 4 && out[0] == 1 && out[3] == 4, "all rings should deliver in order");
+    });
+
+    tr.run("byte ring: variable-length records wrap with padding", [] {
+        constexpr Config cfg{.ring_bits = 9};
+        ByteRing<cfg> ring;
+
+        struct Collect {
+            std::vector<std::string>* out;
+            void process(std::span<const std::byte> record) {
+                out->emplace_back(reinterpret_cast<const char*>(record.data()), record.size());
+            }
+        };
+
+        std::vector<std::string> sent;
+        std::vector<std::string> got;
+        for (int round = 0; round < 20; ++round) {
+            const std::string msg(static_cast<std::size_t>(5 + (round * 37) % 90), static_cast<char>('a' + round));
+            auto w = ring.reserve(msg.size() + 16);
+            expect(w.has_value(), "reserve should succeed on a drained ring");
+            expect(w->slice.size() == msg.size() + 16, "reservation should be contiguous");
+            std::memcpy(w->slice.data(), msg.data(), msg.size());
+            ring.commit(msg.size());
+            sent.push_back(msg);
+            if (round % 2 == 1) {
+                ring.consume_batch(Collect{.out = &got});
+            }
+        }
+        ring.consume_batch(Collect{.out = &got});
+        expect(got == sent, "records should arrive intact and in order");
+        expect(ring.is_empty(), "ring should be empty");
+        expect(!ring.reserve(ByteRing<cfg>::max_record() + 1).has_value(), "oversized record should be rejected");
+        ring.commit(8);
+        expect(ring.is_empty(), "a commit without a reservation should be ignored");
+    });
+
+    tr.run("byte ring: largest record fits after wrap padding", [] {
+        constexpr Config cfg{.ring_bits = 9};
+        ByteRing<cfg> ring;
+
+        struct Count {
+            std::size_t* bytes;
+            void process(std::span<const std::byte> record) { *bytes += record.size(); }
+        };
+
+        std::size_t bytes = 0;
+        for (const std::size_t filler : {1, 56, 120, 232, 240}) {
+            // Drain a short record first so the big one starts mid-buffer.
+            expect(ring.reserve(filler).has_value(), "filler reserve");
+            ring.commit(filler);
+            ring.consume_batch(Count{.bytes = &bytes});
+
+            auto w = ring.reserve(ByteRing<cfg>::max_record());
+            expect(w.has_value(), "max_record() should fit a drained ring at a non-zero offset");
+            ring.commit(ByteRing<cfg>::max_record());
+            expect(ring.consume_batch(Count{.bytes = &bytes}) == 1, "largest record should be delivered");
+            expect(ring.is_empty(), "ring should drain");
+        }
+    });
+
+    tr.run("byte channel: records from several producers", [] {
+        ByteChannel<Config{.ring_bits = 10, .max_producers = 2}> ch;
+        auto p1 = ch.register_producer();
+        auto p2 = ch.register_producer();
+        expect(p1 && p2, "producers should register");
+
+        const std::string a = "hello";
+        const std::string b = "a somewhat longer record";
+        expect(p1->send(std::as_bytes(std::span{a})) == a.size(), "p1 send");
+        expect(p2->send(std::as_bytes(std::span{b})) == b.size(), "p2 send");
+
+        std::size_t bytes = 0;
+        struct Handler {
+            std::size_t* bytes;
+            void process(std::span<const std::byte> record) { *bytes += record.size(); }
+        };
+        expect(ch.consume_all(Handler{.bytes = &bytes}) == 2, "should consume 2 records");
+        expect(bytes == a.size() + b.size(), "payload sizes should match");
+    });
+
+    tr.run("ring: move-only and non-trivial types", [] {
+        {
+            Ring<std::unique_ptr<int>, Config{.ring_bits = 4}> ring;
+            for (int i = 0; i < 20; ++i) {
+                expect(ring.emplace(std::make_unique<int>(i)), "emplace should succeed");
+                std::vector<std::unique_ptr<int>> got;
+                struct Handler {
+                    std::vector<std::unique_ptr<int>>* got;
+                    void process(std::unique_ptr<int>* item) { got->push_back(std::move(*item)); }
+                };
+                expect(ring.consume_batch(Handler{.got = &got}) == 1, "should consume one item");
+                expect(got.size() == 1 && *got[0] == i, "owned pointer should move out intact");
+            }
+        }
+
+        {
+            DynamicRing<Tracked> ring(8);
+            const std::array<Tracked, 3> batch{Tracked{"a"}, Tracked{"b"}, Tracked{"c"}};
+            expect(ring.send(batch) == 3, "send should copy-construct into slots");
+            expect(Tracked::live == 6, "slots should hold live copies");
+
+            std::array<Tracked, 2> out{Tracked{""}, Tracked{""}};
+            expect(ring.recv(out) == 2 && out[0].text == "a" && out[1].text == "b", "recv should move out");
+            expect(Tracked::live == 6, "received slots should be destroyed");
+            expect(ring.emplace("d"), "emplace should construct in place");
+        }
+        expect(Tracked::live == 0, "ring destruction should destroy unconsumed items");
+    });
+
+    tr.run("ring: deferred tail publication", [] {
+        constexpr Config cfg{.ring_bits = 6, .tail_publish_every = 4, .tail_publish_fill = 50};
+        Ring<std::uint64_t, cfg> ring;
+        std::array<std::uint64_t, 64> out{};
+
+        for (std::uint64_t i = 0; i < 3; ++i) {
+            expect(ring.emplace(i), "emplace should succeed");
+        }
+        expect(ring.is_empty() && ring.recv(out) == 0, "three commits should stay unpublished");
+        expect(ring.emplace(std::uint64_t{3}), "fourth emplace should succeed");
+        expect(ring.recv(out) == 4 && out[3] == 3, "fourth commit should publish");
+
+        expect(ring.emplace(std::uint64_t{4}), "emplace should succeed");
+        ring.flush();
+        expect(ring.recv(out) == 1 && out[0] == 4, "flush should publish");
+
+        auto w = ring.reserve(32);
+        expect(w.has_value(), "reserve should succeed");
+        ring.commit(32);
+        expect(ring.len() == 32, "crossing the fill threshold should publish");
+        ring.advance(32);
+
+        // A failed reserve publishes so the consumer can free space.
+        for (std::size_t i = 0; i < ring.capacity(); ++i) {
+            expect(ring.emplace(std::uint64_t{i}), "fill should succeed");
+        }
+        expect(!ring.reserve(1).has_value(), "reserve should fail when full");
+        expect(ring.len() == ring.capacity(), "failed reserve should publish pending items");
+    });
+
+    tr.run("ring: deferred tail publication after the first lap", [] {
+        constexpr Config cfg{.ring_bits = 6, .tail_publish_every = 4, .tail_publish_fill = 50};
+        Ring<std::uint64_t, cfg> ring;
+        std::array<std::uint64_t, 64> out{};
+
+        // Cross the fill threshold once without a failed reserve, then drain.
+        auto w = ring.reserve(40);
+        expect(w.has_value(), "reserve should succeed");
+        ring.commit(40);
+        expect(ring.recv(out) == 40, "crossing the fill threshold should publish");
+
+        for (std::uint64_t i = 0; i < 3; ++i) {
+            expect(ring.emplace(i), "emplace should succeed");
+        }
+        expect(ring.is_empty(), "a drained ring should defer again");
+        expect(ring.emplace(std::uint64_t{3}) && ring.recv(out) == 4, "fourth commit should publish");
+    });
+
+    tr.run("ring: strided head publication", [] {
+        using RingT = Ring<std::uint64_t, Config{.ring_bits = 6, .head_publish_every = 4}>;
+        RingT ring;
+        for (std::uint64_t i = 0; i < 10; ++i) {
+            expect(ring.emplace(i), "emplace should succeed");
+        }
+
+        std::vector<std::size_t> seen;
+        struct Handler {
+            RingT* ring;
+            std::vector<std::size_t>* seen;
+            void process(const std::uint64_t*) { seen->push_back(ring->len()); }
+        };
+        expect(ring.consume_batch(Handler{.ring = &ring, .seen = &seen}) == 10, "should consume 10 items");
+        const std::vector<std::size_t> expected{10, 10, 10, 10, 6, 6, 6, 6, 2, 2};
+        expect(seen == expected, "head should be published every 4 items");
+        expect(ring.len() == 2, "remainder should stay unpublished");
+        expect(ring.consume_batch(Handler{.ring = &ring, .seen = &seen}) == 0, "ring should be drained");
+        expect(ring.is_empty(), "an empty poll should publish the remainder");
+    });
+
+    tr.run("ring: span handlers get whole runs", [] {
+        constexpr Config cfg{.ring_bits = 4, .max_producers = 2};
+        struct SpanSum {
+            std::uint64_t* sum;
+            std::size_t* calls;
+            void process(std::span<const std::uint64_t> run) {
+                ++*calls;
+                for (auto v : run) {
+                    *sum += v;
+                }
+            }
+        };
+
+        Ring<std::uint64_t, cfg> ring;
+        for (std::uint64_t i = 0; i < 12; ++i) {
+            expect(ring.emplace(i), "emplace should succeed");
+        }
+        ring.advance(12);
+        for (std::uint64_t i = 1; i <= 10; ++i) {
+            expect(ring.emplace(i), "emplace should succeed");
+        }
+
+        std::uint64_t sum = 0;
+        std::size_t calls = 0;
+        expect(ring.consume_batch(SpanSum{.sum = &sum, .calls = &calls}) == 10, "should consume 10 items");
+        expect(sum == 55, "sum should be 55");
+        expect(calls == 2, "a wrapped batch should arrive as two runs");
+
+        Channel<std::uint64_t, cfg> ch;
+        auto p1 = ch.register_producer();
+        auto p2 = ch.register_producer();
+        expect(p1 && p2, "producers should register");
+        expect(p1->send(std::span<const std::uint64_t>{std::array<std::uint64_t, 3>{1, 2, 3}}) == 3, "p1 send");
+        expect(p2->send(std::span<const std::uint64_t>{std::array<std::uint64_t, 2>{4, 5}}) == 2, "p2 send");
+        sum = 0;
+        calls = 0;
+        expect(ch.consume_all(SpanSum{.sum = &sum, .calls = &calls}) == 5, "should consume 5 items");
+        expect(sum == 15 && calls == 2, "each ring should hand over one run");
+    });
+
+    tr.run("ring: blocking waits", [] {
+        using namespace std::chrono_literals;
+        constexpr Config cfg{.ring_bits = 2, .max_producers = 2};
+
+        Ring<std::uint64_t, cfg> ring;
+        std::array<std::uint64_t, 4> out{};
+        expect(ring.recv_wait(out, 1ms) == 0, "recv_wait should time out on an empty ring");
+        const std::array<std::uint64_t, 4> full{1, 2, 3, 4};
+        expect(ring.send(full) == 4, "should fill the ring");
+        expect(ring.send_wait(full, 1ms) == 0, "send_wait should time out on a full ring");
+
+        std::thread consumer([&] {
+            std::this_thread::sleep_for(20ms);
+            std::array<std::uint64_t, 4> drained{};
+            ring.recv(drained);
+        });
+        expect(ring.send_wait(full) == 4, "send_wait should resume once the consumer frees space");
+        consumer.join();
+
+        std::uint64_t sum = 0;
+        std::thread producer([&] {
+            std::this_thread::sleep_for(20ms);
+            ring.close();
+        });
+        while (const auto n = ring.recv_wait(out)) {
+            for (std::size_t i = 0; i < n; ++i) {
+                sum += out[i];
+            }
+        }
+        producer.join();
+        expect(sum == 10, "recv_wait should drain before reporting close");
+
+        Channel<std::uint64_t, cfg> ch;
+        auto p = ch.register_producer();
+        expect(p.has_value(), "producer should register");
+        std::thread sender([&] {
+            for (std::uint64_t i = 1; i <= 100; ++i) {
+                const std::array<std::uint64_t, 1> item{i};
+                p->send_wait(item);
+            }
+            ch.close();
+        });
+        sum = 0;
+        while (const auto n = ch.recv_wait(out)) {
+            for (std::size_t i = 0; i < n; ++i) {
+                sum += out[i];
+            }
+        }
+        sender.join();
+        expect(sum == 5050, "channel recv_wait should see every item");
+    });
+
+    tr.run("overwrite ring: producer laps the consumer", [] {
+        constexpr Config cfg{.ring_bits = 3, .max_producers = 2};
+        OverwriteRing<std::uint64_t, cfg> ring;
+
+        for (std::uint64_t i = 0; i < 5; ++i) {
+            expect(ring.push(i), "push should succeed");
+        }
+        std::array<std::uint64_t, 16> out{};
+        expect(ring.recv(out) == 5 && out[0] == 0 && out[4] == 4, "unlapped items arrive in order");
+        expect(ring.overruns() == 0, "nothing lost yet");
+
+        for (std::uint64_t i = 5; i < 25; ++i) {
+            expect(ring.push(i), "push never fails while open");
+        }
+        expect(ring.len() == 8, "len is capped at capacity");
+        const auto n = ring.recv(out);
+        expect(n == 8 && out[0] == 17 && out[7] == 24, "the newest lap should survive");
+        expect(ring.overruns() == 12, "skipped items should be counted");
+
+        OverwriteChannel<std::uint64_t, cfg> ch;
+        auto p = ch.register_producer();
+        expect(p.has_value(), "producer should register");
+        std::array<std::uint64_t, 10> burst{};
+        std::iota(burst.begin(), burst.end(), 0);
+        expect(p->send(burst) == 10, "send should write every item");
+        struct Sum {
+            std::uint64_t* sum;
+            void process(const std::uint64_t* v) { *sum += *v; }
+        };
+        std::uint64_t sum = 0;
+        expect(ch.consume_all(Sum{.sum = &sum}) == 8, "should consume one lap");
+        expect(sum == 2 + 3 + 4 + 5 + 6 + 7 + 8 + 9, "the last lap should be consumed");
+        expect(ch.get_metrics().overruns == 2, "channel metrics should aggregate overruns");
+    });
+
+    tr.run("overwrite ring: items need no default constructor", [] {
+        struct Tick {
+            explicit Tick(std::uint64_t v) : value(v) {}
+            std::uint64_t value;
+        };
+        struct Last {
+            std::uint64_t* last;
+            void process(const Tick* t) { *last = t->value; }
+        };
+        OverwriteRing<Tick, Config{.ring_bits = 2}> ring;
+        for (std::uint64_t i = 1; i <= 6; ++i) {
+            expect(ring.emplace(i), "emplace should succeed");
+        }
+        std::uint64_t last = 0;
+        expect(ring.consume_batch(Last{.last = &last}) == 4 && last == 6, "the newest lap should survive");
+    });
+
+    tr.run("ring: drop-newest accounting", [] {
+        constexpr Config cfg{.ring_bits = 2, .max_producers = 2, .drop_newest = true};
+        Ring<std::uint64_t, cfg> ring;
+
+        const std::array<std::uint64_t, 4> items{1, 2, 3, 4};
+        expect(ring.send(items) == 4, "should fill the ring");
+        expect(ring.dropped() == 0, "nothing dropped yet");
+        expect(ring.send(std::span<const std::uint64_t>{items}.first(2)) == 0, "a full ring rejects the send");
+        expect(!ring.emplace(5), "a full ring rejects emplace");
+        expect(!ring.reserve_with_backoff(1), "reserve_with_backoff should not wait");
+        expect(ring.send_wait(items, std::chrono::seconds(10)) == 0, "send_wait should not wait");
+        expect(ring.dropped() == 8, "every rejected item should be counted");
+        expect(ring.get_metrics().drops == 8, "metrics should report drops");
+
+        std::array<std::uint64_t, 4> out{};
+        expect(ring.recv(out) == 4 && out[3] == 4, "the oldest items survive");
+
+        Channel<std::uint64_t, cfg> ch;
+        auto p1 = ch.register_producer();
+        auto p2 = ch.register_producer();
+        expect(p1 && p2, "producers should register");
+        for (std::uint64_t i = 0; i < 6; ++i) {
+            p1->emplace(i);
+        }
+        for (std::uint64_t i = 0; i < 5; ++i) {
+            p2->emplace(i);
+        }
+        expect(ch.get_metrics().drops == 3, "channel metrics should aggregate drops");
+    });
+
+    tr.run("broadcast ring: every consumer sees every item", [] {
+        constexpr Config cfg{.ring_bits = 3, .max_producers = 1, .max_consumers = 3};
+        BroadcastRing<std::uint64_t, cfg> ring;
+
+        auto fast = ring.register_consumer();
+        auto slow = ring.register_consumer();
+        auto spare = ring.register_consumer();
+        expect(fast && slow && spare, "consumers should register");
+        expect(ring.register_consumer().error() == BroadcastRing<std::uint64_t, cfg>::RegisterError::TooManyConsumers,
+               "the fourth consumer should be refused");
+
+        for (std::uint64_t i = 0; i < 8; ++i) {
+            expect(ring.emplace(i), "emplace should succeed");
+        }
+        expect(!ring.emplace(8), "the slowest cursor should gate the producer");
+
+        struct Sum {
+            std::uint64_t* sum;
+            void process(std::span<const std::uint64_t> run) {
+                for (auto v : run) {
+                    *sum += v;
+                }
+            }
+        };
+        std::uint64_t fast_sum = 0;
+        expect(fast->consume_batch(Sum{.sum = &fast_sum}) == 8 && fast_sum == 28, "fast consumer sees all 8");
+        expect(!ring.emplace(8), "other cursors still hold the space");
+        spare->detach();
+
+        std::array<std::uint64_t, 4> out{};
+        expect(slow->recv(out) == 4 && out[0] == 0 && out[3] == 3, "slow consumer reads independently");
+        for (std::uint64_t i = 8; i < 12; ++i) {
+            expect(ring.emplace(i), "freed space should be reusable");
+        }
+        expect(!ring.emplace(12), "the slow cursor gates again");
+
+        std::uint64_t slow_sum = 0;
+        expect(slow->consume_batch(Sum{.sum = &slow_sum}) == 8, "slow consumer reads across the wrap");
+        expect(slow_sum == 4 + 5 + 6 + 7 + 8 + 9 + 10 + 11, "items should arrive in order");
+        expect(fast->len() == 4, "fast consumer has the new items pending");
+        expect(ring.register_consumer().error() == BroadcastRing<std::uint64_t, cfg>::RegisterError::TooManyConsumers,
+               "slots are not reused");
+
+        BroadcastRing<std::uint64_t, cfg> started;
+        expect(started.emplace(1), "a ring without consumers accepts items");
+        expect(started.register_consumer().error() == BroadcastRing<std::uint64_t, cfg>::RegisterError::Started,
+               "consumers must register before the first reserve");
+    });
+
+    tr.run("channel: consumers lease rings", [] {
+        constexpr Config cfg{.ring_bits = 6, .max_producers = 4};
+        using Ch = Channel<std::uint64_t, cfg>;
+
+        Ch ch;
+        std::vector<Ch::Producer> producers;
+        for (int i = 0; i < 3; ++i) {
+            auto p = ch.register_producer();
+            expect(p.has_value(), "producer should register");
+            producers.push_back(*p);
+        }
+        const std::array<std::uint64_t, 2> items{1, 2};
+        for (auto& p : producers) {
+            expect(p.send(items) == 2, "send should succeed");
+        }
+
+        auto first = ch.make_consumer();
+        auto second = ch.make_consumer();
+        expect(producers[1].ring->try_lease(), "an idle ring can be leased");
+        std::array<std::uint64_t, 8> out{};
+        expect(first.recv(out) == 4, "a leased ring is skipped");
+        expect(second.recv(out) == 0, "nothing else is pending");
+        producers[1].ring->release_lease();
+        expect(second.recv(out) == 2, "a released ring is picked up by any consumer");
+
+        constexpr std::uint64_t per_producer = 20'000;
+        struct Ordered {
+            std::array<std::uint64_t, 3>* last;
+            std::atomic<std::uint64_t>* count;
+            bool* in_order;
+            void process(const std::uint64_t* v) {
+                auto& prev = (*last)[*v >> 32];
+                *in_order = *in_order && (*v & 0xffffffff) > prev;
+                prev = *v & 0xffffffff;
+                count->fetch_add(1, std::memory_order_relaxed);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (std::size_t id = 0; id < producers.size(); ++id) {
+            threads.emplace_back([&, id] {
+                for (std::uint64_t seq = 1; seq <= per_producer; ++seq) {
+                    const std::array<std::uint64_t, 1> item{(id << 32) | seq};
+                    producers[id].send_wait(item);
+                }
+            });
+        }
+
+        std::array<std::uint64_t, 3> shared_last{};
+        std::array<std::atomic<std::uint64_t>, 2> counts{};
+        bool in_order = true;
+        std::atomic<bool> stop{false};
+        std::thread helper([&] {
+            auto consumer = ch.make_consumer();
+            std::array<std::uint64_t, 3> last{};
+            bool ordered = true;
+            while (!stop.load()) {
+                consumer.consume(Ordered{.last = &last, .count = &counts[1], .in_order = &ordered});
+            }
+            in_order = in_order && ordered;
+        });
+        while (counts[0] + counts[1] < per_producer * producers.size()) {
+            first.consume(Ordered{.last = &shared_last, .count = &counts[0], .in_order = &in_order});
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        stop.store(true);
+        helper.join();
+        expect(counts[0] + counts[1] == per_producer * producers.size(), "every item consumed exactly once");
+        expect(in_order, "each consumer should see each ring in FIFO order");
+    });
+
+    tr.run("channel: ready bitmap across words", [] {
+        constexpr Config cfg{.ring_bits = 4, .max_producers = 70};
+        Channel<std::uint64_t, cfg> ch;
+        std::vector<Channel<std::uint64_t, cfg>::Producer> producers;
+        for (std::size_t i = 0; i < cfg.max_producers; ++i) {
+            auto p = ch.register_producer();
+            expect(p.has_value(), "producer should register");
+            producers.push_back(*p);
+        }
+
+        struct Sum {
+            std::uint64_t* sum;
+            void process(const std::uint64_t* v) { *sum += *v; }
+        };
+        std::uint64_t sum = 0;
+        producers[3].emplace(3);
+        producers[66].emplace(66);
+        expect(ch.consume_all(Sum{.sum = &sum}) == 2 && sum == 69, "rings in both words are visited");
+
+        // Long enough idle for both bits to be cleared.
+        for (int i = 0; i < 100; ++i) {
+            expect(ch.consume_all(Sum{.sum = &sum}) == 0, "idle channel yields nothing");
+        }
+        producers[66].emplace(1);
+        producers[69].emplace(2);
+        std::array<std::uint64_t, 4> out{};
+        expect(ch.recv(out) == 2 && out[0] == 1 && out[1] == 2, "a publication after idling raises the bit again");
+        auto consumer = ch.make_consumer();
+        producers[0].emplace(5);
+        expect(consumer.recv(out) == 1 && out[0] == 5, "leasing consumers follow the bitmap too");
+    });
+
+    tr.run("channel: group bitmap over ready words", [] {
+        // More than 4096 rings, so the group bitmap itself spans two words.
+        constexpr std::size_t count = 4200;
+        DynamicChannel<std::uint64_t, Config{.ring_bits = 4, .max_producers = count}> ch(16);
+        std::vector<decltype(ch)::Producer> producers;
+        for (std::size_t i = 0; i < count; ++i) {
+            auto p = ch.register_producer();
+            expect(p.has_value(), "producer should register");
+            producers.push_back(*p);
+        }
+
+        std::array<std::uint64_t, 4> out{};
+        producers[5].emplace(std::uint64_t{5});
+        producers[4100].emplace(std::uint64_t{4100});
+        expect(ch.recv(out) == 2 && out[0] == 5 && out[1] == 4100, "rings in both groups are visited");
+        for (int i = 0; i < 100; ++i) {
+            expect(ch.recv(out) == 0, "idle channel yields nothing");
+        }
+        producers[4199].emplace(std::uint64_t{1});
+        producers[64].emplace(std::uint64_t{2});
+        producers[65].emplace(std::uint64_t{3});
+        expect(ch.recv(out) == 3 && out[0] == 2 && out[1] == 3 && out[2] == 1,
+               "cleared word and group bits are raised again");
+    });
+
+    tr.run("channel: deregistered slots are recycled once drained", [] {
+        constexpr Config cfg{.ring_bits = 4, .max_producers = 2};
+        using Ch = Channel<std::uint64_t, cfg>;
+        struct Sum {
+            std::uint64_t* sum;
+            void process(const std::uint64_t* v) { *sum += *v; }
+        };
+
+        Ch ch;
+        std::uint64_t sum = 0;
+        auto a = ch.register_scoped();
+        auto b = ch.register_scoped();
+        expect(a && b, "producers should register");
+        expect(ch.register_producer().error() == Ch::RegisterError::TooManyProducers, "table is full");
+
+        (*a)->emplace(std::uint64_t{1});
+        (*a)->emplace(std::uint64_t{2});
+        auto* first_ring = (*a)->ring;
+        a->reset();
+        expect(!ch.register_producer(), "an undrained slot is not reused");
+        expect(ch.consume_all(Sum{.sum = &sum}) == 2 && sum == 3, "items committed before deregistering arrive");
+        expect(ch.consume_all(Sum{.sum = &sum}) == 0, "the drained ring is recycled on the next pass");
+
+        {
+            auto c = ch.register_scoped();
+            expect(c && (*c)->id == 0 && (*c)->ring == first_ring, "the slot and its ring are reused");
+            (*c)->emplace(std::uint64_t{10});
+            expect(ch.consume_all(Sum{.sum = &sum}) == 1 && sum == 13, "the new producer is delivered");
+        }
+        ch.consume_all(Sum{.sum = &sum});
+        expect(ch.register_producer().has_value(), "a scoped producer deregisters when destroyed");
+        expect(ch.producer_count() == 2, "recycling does not grow the table");
+    });
+
+    tr.run("channel: thread-local producers", [] {
+        constexpr Config cfg{.ring_bits = 4, .max_producers = 4};
+        struct Sum {
+            std::uint64_t* sum;
+            void process(const std::uint64_t* v) { *sum += *v; }
+        };
+
+        Channel<std::uint64_t, cfg> ch;
+        Channel<std::uint64_t, cfg> other;
+        std::uint64_t sum = 0;
+        expect(ch.emplace_local(std::uint64_t{1}), "the first call registers the thread");
+        expect(other.emplace_local(std::uint64_t{100}), "each channel gets its own registration");
+        const std::array<std::uint64_t, 2> pair{2, 3};
+        expect(ch.send_local(pair) == 2, "later calls reuse the ring");
+        if (auto r = ch.reserve_local(1)) {
+            r->slice[0] = 4;
+            ch.commit_local(*r, 1);
+        }
+        auto held = ch.local_producer();
+        expect(held && held->id == 0 && held->emplace(std::uint64_t{0}), "the thread's Producer can be held");
+        expect(ch.producer_count() == 1 && other.producer_count() == 1, "one ring per thread and channel");
+
+        std::thread t([&] { ch.emplace_local(std::uint64_t{10}); });
+        t.join();
+        expect(ch.producer_count() == 2, "another thread registers separately");
+        expect(ch.consume_all(Sum{.sum = &sum}) == 6 && sum == 20, "items from exited threads still arrive");
+        ch.consume_all(Sum{.sum = &sum});
+        auto p = ch.register_producer();
+        expect(p && p->id == 1, "the exited thread's slot is recycled");
+
+        // A thread outliving its channel must not touch the channel's rings at exit.
+        std::thread late([] {
+            auto gone = std::make_unique<Channel<std::uint64_t, cfg>>();
+            gone->emplace_local(std::uint64_t{1});
+        });
+        late.join();
+
+        // Registrations on destroyed channels are dropped, not accumulated.
+        std::size_t entries = 0;
+        std::thread churn([&entries] {
+            for (int i = 0; i < 100; ++i) {
+                Channel<std::uint64_t, cfg> brief;
+                brief.emplace_local(std::uint64_t{1});
+            }
+            entries = detail::local_producers.entries.size();
+        });
+        churn.join();
+        expect(entries == 1, "dead registrations should be dropped");
+    });
+
+    tr.run("channel: scheduling policies", [] {
+        struct Record {
+            std::vector<std::uint64_t>* seen;
+            void process(const std::uint64_t* v) { seen->push_back(*v); }
+        };
+        // Three producers; item value = producer * 100 + sequence.
+        const auto fill = [](auto& ch, std::uint64_t per_producer) {
+            for (std::uint64_t p = 0; p < 3; ++p) {
+                auto producer = ch.register_producer();
+                for (std::uint64_t i = 0; i < per_producer; ++i) {
+                    producer->emplace(p * 100 + i);
+                }
+            }
+        };
+
+        constexpr Config rotate_cfg{.ring_bits = 4, .max_producers = 4, .schedule = Schedule::Rotate};
+        Channel<std::uint64_t, rotate_cfg> rotate;
+        fill(rotate, 4);
+        std::array<std::uint64_t, 2> out{};
+        expect(rotate.recv(out) == 2 && out[0] == 0, "the first call starts at ring 0");
+        expect(rotate.recv(out) == 2 && out[0] == 100, "the next call starts at ring 1");
+        expect(rotate.recv(out) == 2 && out[0] == 200, "the next call starts at ring 2");
+        expect(rotate.recv(out) == 2 && out[0] == 2, "rotation wraps to ring 0");
+
+        constexpr Config quota_cfg{.ring_bits = 4, .max_producers = 4, .schedule = Schedule::Quota, .schedule_quota = 2};
+        Channel<std::uint64_t, quota_cfg> quota;
+        fill(quota, 5);
+        std::vector<std::uint64_t> seen;
+        expect(quota.consume_all(Record{.seen = &seen}) == 6, "each ring yields its quota");
+        const std::vector<std::uint64_t> first_pass{0, 1, 100, 101, 200, 201};
+        expect(seen == first_pass, "rings are interleaved from the rotating start");
+        expect(quota.consume_all(Record{.seen = &seen}) == 6 && quota.consume_all(Record{.seen = &seen}) == 3,
+               "the remainder drains in later calls");
+
+        constexpr Config weighted_cfg{
+            .ring_bits = 4, .max_producers = 4, .schedule = Schedule::Weighted, .schedule_quota = 1};
+        Channel<std::uint64_t, weighted_cfg> weighted;
+        fill(weighted, 6);
+        weighted.set_weight(2, 3);
+        seen.clear();
+        expect(weighted.consume_all(Record{.seen = &seen}) == 5, "weights scale the quota");
+        const std::vector<std::uint64_t> weighted_pass{0, 100, 200, 201, 202};
+        expect(seen == weighted_pass, "producer 2 gets three items per call");
+
+        // A recycled slot starts over at the default weight.
+        Channel<std::uint64_t, weighted_cfg> recycled;
+        auto old = recycled.register_producer();
+        recycled.set_weight(old->id, 3);
+        recycled.deregister_producer(*old);
+        expect(recycled.consume_all(Record{.seen = &seen}) == 0, "the drained slot is recycled");
+        auto fresh = recycled.register_producer();
+        expect(fresh && fresh->id == old->id, "the slot is reused");
+        for (std::uint64_t i = 0; i < 3; ++i) {
+            fresh->emplace(i);
+        }
+        expect(recycled.consume_all(Record{.seen = &seen}) == 1, "the new producer has the default weight");
+    });
+
+    tr.run("channel: merged consumption is key-ordered", [] {
+        struct Event {
+            std::uint64_t ts;
+            std::uint32_t source;
+        };
+        struct Runs {
+            std::vector<std::uint64_t>* ts;
+            std::size_t* calls;
+            void process(std::span<const Event> run) {
+                ++*calls;
+                for (const auto& e : run) {
+                    ts->push_back(e.ts);
+                }
+            }
+        };
+        constexpr Config cfg{.ring_bits = 3, .max_producers = 4};
+
+        Channel<Event, cfg> ch;
+        auto a = ch.register_producer();
+        auto b = ch.register_producer();
+        auto c = ch.register_producer();
+        expect(a && b && c, "producers should register");
+        // Wrap ring a so its items span the end of the buffer.
+        for (int i = 0; i < 6; ++i) {
+            a->emplace(Event{.ts = 0, .source = 0});
+        }
+        std::array<Event, 8> drain{};
+        expect(ch.recv(drain) == 6, "prime ring a");
+        for (std::uint64_t ts : {1, 2, 3, 10, 11, 12}) {
+            a->emplace(Event{.ts = ts, .source = 0});
+        }
+        for (std::uint64_t ts : {4, 5, 13}) {
+            b->emplace(Event{.ts = ts, .source = 1});
+        }
+        for (std::uint64_t ts : {5, 6, 7, 14}) {
+            c->emplace(Event{.ts = ts, .source = 2});
+        }
+
+        std::vector<std::uint64_t> ts;
+        std::size_t calls = 0;
+        expect(ch.consume_merged(&Event::ts, Runs{.ts = &ts, .calls = &calls}) == 11, "merge until a ring runs dry");
+        const std::vector<std::uint64_t> merged{1, 2, 3, 4, 5, 5, 6, 7, 10, 11, 12};
+        expect(ts == merged, "items should come out in key order");
+        expect(calls == 5, "consecutive items of one ring form one run, split only at the wrap");
+
+        // Ring a ran dry, so 13 and 14 waited for it; once a has an item
+        // again the merge resumes in order.
+        a->emplace(Event{.ts = 20, .source = 0});
+        ts.clear();
+        const auto by_ts = [](const Event& e) { return e.ts; };
+        while (ch.consume_merged(by_ts, Runs{.ts = &ts, .calls = &calls}) != 0) {
+        }
+        expect(ts == std::vector<std::uint64_t>{13, 14, 20}, "the remainder follows in order");
+    });
+
+    tr.run("channel: merged consumption breaks ties by ring index", [] {
+        struct Event {
+            std::uint64_t ts;
+            std::uint32_t source;
+        };
+        struct Record {
+            std::vector<std::uint32_t>* sources;
+            void process(const Event* e) { sources->push_back(e->source); }
+        };
+        constexpr Config cfg{.ring_bits = 3, .max_producers = 3};
+
+        Channel<Event, cfg> ch;
+        auto a = ch.register_producer();
+        auto b = ch.register_producer();
+        auto c = ch.register_producer();
+        expect(a && b && c, "producers should register");
+        for (std::uint64_t ts : {2, 3, 9}) {
+            a->emplace(Event{.ts = ts, .source = 0});
+        }
+        for (std::uint64_t ts : {1, 2, 2, 3, 9}) {
+            b->emplace(Event{.ts = ts, .source = 1});
+        }
+        for (std::uint64_t ts : {1, 1, 3, 9}) {
+            c->emplace(Event{.ts = ts, .source = 2});
+        }
+
+        std::vector<std::uint32_t> sources;
+        expect(ch.consume_merged(&Event::ts, Record{.sources = &sources}) == 10, "merge until a ring runs dry");
+        const std::vector<std::uint32_t> order{1, 2, 2, 0, 1, 1, 0, 1, 2, 0};
+        expect(sources == order, "equal keys should come out in ring index order");
+    });
+
+    tr.run("channel: zero-copy readable lease", [] {
+        constexpr Config cfg{.ring_bits = 3, .max_producers = 3};
+
+        Channel<std::uint64_t, cfg> ch;
+        auto a = ch.register_producer();
+        auto b = ch.register_producer();
+        auto c = ch.register_producer();
+        expect(a && b && c, "producers should register");
+        // Leave ring a's head at slot 6 so its next five items wrap.
+        for (std::uint64_t i = 0; i < 6; ++i) {
+            a->emplace(i);
+        }
+        std::array<std::uint64_t, 8> drain{};
+        expect(ch.recv(drain) == 6, "prime ring a");
+        for (std::uint64_t i = 10; i < 15; ++i) {
+            a->emplace(i);
+        }
+        c->emplace(std::uint64_t{20});
+
+        auto regions = ch.lease_readable();
+        expect(regions.size() == 2, "only rings with items are leased");
+        expect(regions[0].producer_id == 0 && regions[1].producer_id == 2, "regions come in ring order");
+        expect(regions[0].first.size() == 2 && regions[0].second.size() == 3, "a wrapped ring yields two spans");
+        expect(regions[0].first[0] == 10 && regions[0].second[0] == 12, "spans point at the items in order");
+        expect(regions[1].size() == 1 && regions[1].second.empty(), "an unwrapped ring yields one span");
+
+        regions[0].consumed = 3;
+        regions[1].consumed = 5;  // clamped to the region
+        expect(ch.release_readable() == 4, "release advances by what was consumed");
+
+        regions = ch.lease_readable();
+        expect(regions.size() == 1 && regions[0].first[0] == 13 && regions[0].size() == 2, "the rest stays queued");
+        regions[0].consumed = regions[0].size();
+        expect(ch.release_readable() == 2, "the remainder is released");
+        expect(ch.lease_readable().empty(), "nothing left");
+        ch.release_readable();
+    });
+
+    tr.run("channel: sequence stamps give a total order", [] {
+        struct Stamped {
+            std::vector<std::uint64_t>* values;
+            std::vector<std::uint64_t>* seqs;
+            void process(const std::uint64_t* v, std::uint64_t seq) {
+                values->push_back(*v);
+                seqs->push_back(seq);
+            }
+        };
+        // Tails are published every second commit, so a ticket can be taken
+        // before its items are visible.
+        constexpr Config cfg{.ring_bits = 4, .max_producers = 3, .tail_publish_every = 2, .sequence_stamps = true};
+
+        Channel<std::uint64_t, cfg> ch;
+        auto a = ch.register_producer();
+        auto b = ch.register_producer();
+        auto c = ch.register_producer();
+        expect(a && b && c, "producers should register");
+        const std::array<std::uint64_t, 2> pair{0, 1};
+        expect(a->send(pair) == 2, "one commit takes two tickets");
+        a->emplace(std::uint64_t{2});
+        b->emplace(std::uint64_t{3});  // not yet published
+        c->emplace(std::uint64_t{4});
+        c->emplace(std::uint64_t{5});
+
+        std::vector<std::uint64_t> values;
+        std::vector<std::uint64_t> seqs;
+        expect(ch.consume_sequenced(Stamped{.values = &values, .seqs = &seqs}) == 3, "stop at the unpublished ticket");
+        expect(ch.next_sequence() == 3, "resume from the gap");
+
+        b->flush();
+        expect(ch.consume_sequenced(Stamped{.values = &values, .seqs = &seqs}) == 3, "the gap is filled");
+        const std::vector<std::uint64_t> order{0, 1, 2, 3, 4, 5};
+        expect(values == order, "items come out in commit order across rings");
+        expect(seqs == order, "handlers see each item's sequence");
+
+        // The stamp is also readable next to a plain readable() span.
+        Ring<std::uint64_t, Config{.ring_bits = 4, .sequence_stamps = true}> ring;
+        ring.emplace(std::uint64_t{7});
+        ring.emplace(std::uint64_t{8});
+        const auto run = ring.readable();
+        expect(run && ring.sequence_of(&(*run)[1]) == 1, "a standalone ring counts on its own");
+    });
+
+    tr.run("poller: one thread services channels of different types", [] {
+        struct Cancel {
+            std::uint32_t order;
+            std::uint32_t reason;
+        };
+        struct Orders {
+            std::uint64_t* sum;
+            void process(const std::uint64_t* v) { *sum += *v; }
+        };
+        struct Cancels {
+            std::uint64_t* sum;
+            void process(const Cancel* c) { *sum += c->order; }
+        };
+        constexpr Config cfg{.ring_bits = 4, .max_producers = 2};
+
+        Channel<std::uint64_t, cfg> orders;
+        DynamicChannel<Cancel, cfg> cancels(16);
+        std::uint64_t order_sum = 0;
+        std::uint64_t cancel_sum = 0;
+        Poller poller;
+        expect(poller.add(orders, Orders{.sum = &order_sum}), "add the first channel");
+        expect(poller.add(cancels, Cancels{.sum = &cancel_sum}), "add a channel of another type");
+        expect(!poller.add(orders, Orders{.sum = &order_sum}), "a channel joins one poller once");
+
+        auto o = orders.register_producer();
+        auto c = cancels.register_producer();
+        expect(o && c, "producers should register");
+        o->emplace(std::uint64_t{5});
+        expect(poller.poll() == 1 && order_sum == 5, "a ready channel is drained with its handler");
+
+        // Idle until every bit has been cleared, then publish again.
+        for (int i = 0; i < 100; ++i) {
+            expect(poller.poll() == 0, "idle channels yield nothing");
+        }
+        c->emplace(Cancel{.order = 7, .reason = 0});
+        expect(poller.poll() == 1 && cancel_sum == 7, "a publication raises the channel's bit again");
+
+        expect(poller.poll_wait(std::chrono::milliseconds(5)) == 0, "timeout when every channel is idle");
+        std::thread producer([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            o->emplace(std::uint64_t{11});
+        });
+        expect(poller.poll_wait() == 1 && order_sum == 16, "one wait wakes for any channel");
+        producer.join();
+
+        std::thread closer([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            orders.close();
+            cancels.close();
+        });
+        expect(poller.poll_wait() == 0, "closing every channel ends the wait");
+        closer.join();
+    });
+
+    tr.run("poller: handlers may be move-only", [] {
+        struct Owned {
+            std::unique_ptr<std::uint64_t> sum;
+            void process(const std::uint64_t* v) { *sum += *v; }
+        };
+        Channel<std::uint64_t, Config{.ring_bits = 4, .max_producers = 2}> ch;
+        Poller poller;
+        auto sum = std::make_unique<std::uint64_t>(0);
+        auto* total = sum.get();
+        expect(poller.add(ch, Owned{.sum = std::move(sum)}), "a move-only handler is accepted");
+        auto p = ch.register_producer();
+        expect(p.has_value(), "producer should register");
+        p->emplace(std::uint64_t{3});
+        expect(poller.poll() == 1 && *total == 3, "the poller owns the handler");
+    });
+
+#if defined(__linux__)
+    tr.run("channel: eventfd notification is coalesced", [] {
+        constexpr Config cfg{.ring_bits = 4, .max_producers = 2};
+        const auto readable = [](int fd) {
+            pollfd pfd{.fd = fd, .events = POLLIN, .revents = 0};
+            return ::poll(&pfd, 1, 0) == 1;
+        };
+
+        Channel<std::uint64_t, cfg> ch;
+        auto p1 = ch.register_producer();
+        auto p2 = ch.register_producer();
+        expect(p1 && p2, "producers should register");
+        const int fd = ch.notification_fd();
+        expect(fd >= 0, "eventfd should be created");
+        expect(!readable(fd), "an empty channel should not signal");
+
+        const std::array<std::uint64_t, 2> items{1, 2};
+        for (int i = 0; i < 3; ++i) {
+            expect(p1->send(items) == 2 && p2->send(items) == 2, "sends should succeed");
+        }
+        expect(readable(fd), "publishing into an empty channel should signal");
+        std::uint64_t writes = 0;
+        expect(::read(fd, &writes, sizeof(writes)) == sizeof(writes) && writes == 1, "a burst should write once");
+
+        std::array<std::uint64_t, 16> out{};
+        expect(ch.recv(out) == 12, "should drain 12 items");
+        ch.rearm_notification();
+        expect(!readable(fd), "a drained, rearmed channel should not signal");
+
+        expect(p2->send(items) == 2, "send should succeed");
+        expect(ch.recv(out) == 2, "should drain 2 items");
+        expect(readable(fd), "the next publication should signal again");
+        ch.rearm_notification();
+        expect(!readable(fd), "nothing pending after rearm");
+
+        expect(p1->send(items) == 2, "send should succeed");
+        std::uint64_t discard = 0;
+        expect(::read(fd, &discard, sizeof(discard)) == sizeof(discard), "fd should be signalled");
+        ch.rearm_notification();
+        expect(readable(fd), "rearming with items pending should signal at once");
+    });
+#endif
+
     tr.run("backoff: spin progression", [] {
         Backoff b;
         expect(!b.is_completed(), "initially not completed");